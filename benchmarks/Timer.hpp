@@ -0,0 +1,31 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace quant::bench {
+
+class Timer {
+public:
+    Timer() : start_(std::chrono::steady_clock::now()) {}
+    double seconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Calls fn until at least min_seconds have elapsed and returns the mean seconds per call.
+template <typename Fn>
+double seconds_per_call(Fn&& fn, double min_seconds = 0.2) {
+    Timer timer;
+    std::size_t calls = 0;
+    do {
+        fn();
+        ++calls;
+    } while (timer.seconds() < min_seconds);
+    return timer.seconds() / static_cast<double>(calls);
+}
+
+} // namespace quant::bench
@@ -0,0 +1,50 @@
+// Barrier pricing throughput and accuracy: analytic engine vs the CRR lattice over a 20k-option book.
+#include "Timer.hpp"
+#include "quant/pricing/BarrierOption.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace quant::pricing;
+using namespace quant::instruments;
+
+int main() {
+    std::vector<BarrierOption> book;
+    const BarrierType types[] = {BarrierType::UpAndOut, BarrierType::DownAndOut, BarrierType::UpAndIn,
+                                 BarrierType::DownAndIn};
+    for (std::size_t i = 0; i < 20000; ++i) {
+        BarrierType type = types[i % 4];
+        bool up = type == BarrierType::UpAndOut || type == BarrierType::UpAndIn;
+        double strike = 80.0 + static_cast<double>(i % 41);
+        double barrier = up ? 115.0 + static_cast<double>(i % 13) : 85.0 - static_cast<double>(i % 13);
+        book.emplace_back(type, i % 3 ? OptionType::Call : OptionType::Put, 100.0, strike,
+                          0.25 + 0.05 * static_cast<double>(i % 20), 0.02, 0.15 + 0.01 * static_cast<double>(i % 25),
+                          barrier, i % 5 ? 0.0 : 1.0);
+    }
+
+    AnalyticBarrierEngine analytic;
+    std::vector<double> exact(book.size());
+    double sec = quant::bench::seconds_per_call([&] {
+        for (std::size_t i = 0; i < book.size(); ++i) exact[i] = analytic.price(book[i]);
+    });
+    std::printf("%-16s %10s %14s %12s\n", "engine", "book ms", "options/s", "max |err|");
+    std::printf("%-16s %10.2f %14.0f %12s\n", "analytic", 1e3 * sec, static_cast<double>(book.size()) / sec, "-");
+
+    for (std::size_t steps : {std::size_t{200}, std::size_t{1000}}) {
+        BarrierOptionEngine lattice(steps);
+        // The lattice is slow; time and check a strided sample of the book.
+        constexpr std::size_t stride = 100;
+        double max_err = 0.0;
+        double lsec = quant::bench::seconds_per_call([&] {
+            for (std::size_t i = 0; i < book.size(); i += stride) {
+                max_err = std::max(max_err, std::fabs(lattice.price(book[i]) - exact[i]));
+            }
+        });
+        double per_option = lsec / static_cast<double>(book.size() / stride);
+        std::printf("lattice(%4zu)    %10.2f %14.0f %12.5f\n", steps, 1e3 * per_option * book.size(), 1.0 / per_option,
+                    max_err);
+    }
+    return 0;
+}
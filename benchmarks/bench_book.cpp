@@ -0,0 +1,70 @@
+// Heterogeneous 1M-instrument book: the virtual path (shared_ptr<Instrument>, a dynamic_cast to
+// pick the engine, then PricingEngine::price with its own cast) against the typed Book and
+// BookPricer. Swaps are few because VanillaSwap::npv rebuilds its schedules on every call.
+#include "Timer.hpp"
+#include "quant/market/YieldCurve.hpp"
+#include "quant/pricing/BlackScholes.hpp"
+#include "quant/pricing/Book.hpp"
+#include "quant/pricing/DiscountingSwap.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::pricing;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+int main() {
+    constexpr std::size_t n = 1000000;
+    quant::market::YieldCurve curve({0.5, 1.0, 2.0, 5.0, 10.0}, {0.02, 0.022, 0.025, 0.03, 0.032});
+    std::vector<std::shared_ptr<Instrument>> portfolio;
+    portfolio.reserve(n);
+    Book book;
+    for (std::size_t i = 0; i < n; ++i) {
+        double k = 70.0 + 60.0 * static_cast<double>(i % 1000) / 1000.0;
+        if (i % 5000 == 0) {
+            Schedule s{Date(2024, 1, 15), Date(2025 + static_cast<int>(i % 9), 1, 15), Frequency::SemiAnnual};
+            VanillaSwap swap(SwapType::Payer, 1e6, 0.025, s, s, DayCountConvention::ACT_365,
+                             DayCountConvention::ACT_365, &curve);
+            portfolio.push_back(std::make_shared<VanillaSwap>(swap));
+            book.add(swap);
+        } else if (i % 7 == 0) {
+            BarrierOption opt(BarrierType::UpAndOut, OptionType::Call, 100.0, k, 1.0, 0.03, 0.2, 150.0);
+            portfolio.push_back(std::make_shared<BarrierOption>(opt));
+            book.add(opt);
+        } else {
+            EuropeanOption opt(i % 2 ? OptionType::Call : OptionType::Put, 100.0, k, 0.25 + (i % 40) * 0.1, 0.03,
+                               0.2 + (i % 13) * 0.01, 0.01);
+            portfolio.push_back(std::make_shared<EuropeanOption>(opt));
+            book.add(opt);
+        }
+    }
+    std::printf("%zu instruments: %zu European, %zu barrier, %zu swaps\n", n, book.group<EuropeanOption>().size(),
+                book.group<BarrierOption>().size(), book.group<VanillaSwap>().size());
+
+    const BlackScholesEuropeanEngine bs;
+    const AnalyticBarrierEngine barrier;
+    const DiscountingSwapEngine swap;
+    const PricingEngine* engines[3] = {&bs, &barrier, &swap};
+    double virtual_total = 0.0;
+    quant::bench::Timer timer;
+    for (const auto& inst : portfolio) {
+        const PricingEngine* engine = dynamic_cast<const EuropeanOption*>(inst.get())  ? engines[0]
+                                      : dynamic_cast<const BarrierOption*>(inst.get()) ? engines[1]
+                                                                                        : engines[2];
+        virtual_total += engine->price(*inst);
+    }
+    double virtual_sec = timer.seconds();
+    std::printf("%-28s %8.1f ms  total %.6e\n", "virtual path", 1e3 * virtual_sec, virtual_total);
+
+    for (std::size_t threads : {std::size_t{1}, std::size_t{0}}) {
+        BookPricer pricer(threads);
+        double total = 0.0;
+        double sec = quant::bench::seconds_per_call([&] { total = pricer.total(book); }, 0.5);
+        std::printf("BookPricer (threads=%zu)     %8.1f ms  total %.6e  speedup %.1fx\n", threads, 1e3 * sec, total,
+                    virtual_sec / sec);
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+// 40-pillar curve from deposits, FRAs and swaps: full bootstrap against single-quote updates,
+// which re-solve only the ticked pillar and those after it.
+#include "Timer.hpp"
+#include "quant/market/CurveBootstrapper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::market;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+int main() {
+    CurveBootstrapper bootstrapper;
+    std::vector<double> quotes;
+    auto level = [](double t) { return 0.03 + 0.008 * (1.0 - std::exp(-t / 3.0)); };
+    for (double t : {7.0 / 365, 1.0 / 12, 2.0 / 12, 0.25}) {
+        bootstrapper.add_deposit(t, level(t));
+        quotes.push_back(level(t));
+    }
+    for (int i = 1; i <= 7; ++i) {
+        double s = 0.25 * i;
+        bootstrapper.add_fra(s, s + 0.25, level(s + 0.25));
+        quotes.push_back(level(s + 0.25));
+    }
+    std::vector<int> years;
+    for (int y = 3; y <= 30; ++y) years.push_back(y);
+    years.push_back(40);
+    for (int y : years) {
+        Schedule fixed{Date(2024, 1, 15), Date(2024 + y, 1, 15), Frequency::Annual};
+        Schedule floating{Date(2024, 1, 15), Date(2024 + y, 1, 15), Frequency::Quarterly};
+        bootstrapper.add_swap(VanillaSwap(SwapType::Payer, 1e6, level(y), fixed, floating,
+                                          DayCountConvention::ACT_365, DayCountConvention::ACT_360, nullptr));
+        quotes.push_back(level(y));
+    }
+    const std::size_t n = bootstrapper.size();
+    std::printf("%zu pillars: 4 deposits, 7 FRAs, %zu swaps (annual fixed, quarterly float)\n", n, years.size());
+
+    quant::bench::Timer timer;
+    bootstrapper.curve();
+    std::printf("%-34s %9.2f us\n", "first bootstrap (layout + solve)", 1e6 * timer.seconds());
+
+    // Full re-solve: every pillar moves, as after a tick on the first deposit.
+    double bump = 1e-6;
+    double full = quant::bench::seconds_per_call([&] {
+        bump = -bump;
+        bootstrapper.set_quote(0, quotes[0] + bump);
+        bootstrapper.curve();
+    });
+    std::printf("%-34s %9.2f us\n", "update of the first pillar (full)", 1e6 * full);
+
+    std::vector<double> per_pillar(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        per_pillar[i] = quant::bench::seconds_per_call(
+            [&] {
+                bump = -bump;
+                bootstrapper.set_quote(i, quotes[i] + bump);
+                bootstrapper.curve();
+            },
+            0.02);
+    }
+    std::vector<double> sorted = per_pillar;
+    std::sort(sorted.begin(), sorted.end());
+    double mean = 0.0;
+    for (double s : per_pillar) mean += s / static_cast<double>(n);
+    std::printf("%-34s %9.2f us mean, %.2f us median, %.2f us worst\n", "single-quote update, every pillar", 1e6 * mean,
+                1e6 * sorted[n / 2], 1e6 * sorted.back());
+    for (std::size_t i : {std::size_t{10}, std::size_t{20}, n - 1}) {
+        std::printf("  pillar %2zu %-23s %9.2f us\n", i, "", 1e6 * per_pillar[i]);
+    }
+    return 0;
+}
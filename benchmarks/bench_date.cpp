@@ -0,0 +1,117 @@
+// year_fraction over 1M date pairs: the mktime-based day count Date used before (local midnights
+// subtracted and divided into days) against integer serial-day arithmetic; also civil-date round
+// trips, add_months and a 10k-swap schedule build. Then business days between 100k date pairs and
+// 20 business days on from each start: stepping a day at a time against a std::set of holidays
+// (the old Calendar) against the bitset Calendar's prefix counts.
+#include "Timer.hpp"
+#include "quant/instruments/VanillaSwap.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <set>
+#include <vector>
+
+using namespace quant::instruments;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+namespace {
+std::chrono::system_clock::time_point local_midnight(const Date& d) {
+    std::tm tm{};
+    tm.tm_year = d.year() - 1900;
+    tm.tm_mon = static_cast<int>(d.month()) - 1;
+    tm.tm_mday = static_cast<int>(d.day());
+    tm.tm_isdst = -1;
+    return std::chrono::system_clock::from_time_t(std::mktime(&tm));
+}
+
+double mktime_year_fraction(const Date& start, const Date& end) {
+    auto hours = std::chrono::duration_cast<std::chrono::hours>(local_midnight(end) - local_midnight(start)).count();
+    return static_cast<double>(hours / 24) / 365.0;
+}
+}
+
+int main() {
+    const std::size_t n = 1000000;
+    std::vector<Date> starts, ends;
+    starts.reserve(n);
+    ends.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        starts.push_back(Date(2024, 1, 1).add_days(static_cast<int>(i % 3650)));
+        ends.push_back(starts.back().add_days(static_cast<int>(1 + (i * 7919) % 10950)));
+    }
+    std::printf("%zu date pairs\n", n);
+    double sums[2] = {0.0, 0.0};
+    double seconds[2];
+    seconds[0] = quant::bench::seconds_per_call([&] {
+        double s = 0.0;
+        for (std::size_t i = 0; i < n; ++i) s += mktime_year_fraction(starts[i], ends[i]);
+        sums[0] = s;
+    }, 1.0);
+    seconds[1] = quant::bench::seconds_per_call([&] {
+        double s = 0.0;
+        for (std::size_t i = 0; i < n; ++i) s += year_fraction(starts[i], ends[i], DayCountConvention::ACT_365);
+        sums[1] = s;
+    }, 1.0);
+    std::printf("%-32s %9.2f ns/pair  (sum %.6f)\n", "year_fraction via mktime", 1e9 * seconds[0] / n, sums[0]);
+    std::printf("%-32s %9.2f ns/pair  (sum %.6f)  %.0fx\n", "year_fraction on serial days", 1e9 * seconds[1] / n,
+                sums[1], seconds[0] / seconds[1]);
+
+    long check = 0;
+    double civil = quant::bench::seconds_per_call([&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto c = ends[i].civil();
+            check += Date(c.year, c.month, c.day).serial();
+        }
+    });
+    double months = quant::bench::seconds_per_call([&] {
+        for (std::size_t i = 0; i < n; ++i) check += starts[i].add_months(static_cast<int>(i % 360)).serial();
+    });
+    std::printf("%-32s %9.2f ns/date\n", "civil round trip", 1e9 * civil / n);
+    std::printf("%-32s %9.2f ns/date  (check %ld)\n", "add_months", 1e9 * months / n, check);
+
+    std::vector<VanillaSwap> swaps;
+    swaps.reserve(10000);
+    quant::bench::Timer build;
+    for (int i = 0; i < 10000; ++i) {
+        Date start(2024, 1 + i % 12, 1 + i % 28);
+        Schedule fixed{start, start.add_months(12 * (1 + i % 30)), Frequency::Annual};
+        Schedule floating{fixed.start, fixed.end, Frequency::Quarterly};
+        swaps.emplace_back(SwapType::Payer, 1e6, 0.03, fixed, floating, DayCountConvention::ACT_365,
+                           DayCountConvention::ACT_360, nullptr);
+    }
+    std::printf("%-32s %9.2f ms for %zu swaps\n", "VanillaSwap construction", 1e3 * build.seconds(), swaps.size());
+
+    std::set<Date> holidays;
+    for (int y = 2024; y <= 2070; ++y) {
+        for (auto [m, d] : {std::pair{1u, 1u}, {5u, 1u}, {7u, 4u}, {12u, 25u}, {12u, 26u}}) holidays.insert(Date(y, m, d));
+    }
+    const quant::core::Calendar calendar(holidays);
+    auto business = [&](const Date& d) { return !d.is_weekend() && !holidays.count(d); };
+    const std::size_t pairs = 100000;
+    long stepped = 0, counted = 0;
+    double step_seconds = quant::bench::seconds_per_call([&] {
+        stepped = 0;
+        for (std::size_t i = 0; i < pairs; ++i) {
+            for (Date d = starts[i]; d < ends[i]; d = d.add_days(1)) stepped += business(d);
+            Date d = starts[i];
+            for (int k = 0; k < 20;) {
+                d = d.add_days(1);
+                k += business(d);
+            }
+            stepped += d.serial();
+        }
+    });
+    double table_seconds = quant::bench::seconds_per_call([&] {
+        counted = 0;
+        for (std::size_t i = 0; i < pairs; ++i) {
+            counted += calendar.business_days_between(starts[i], ends[i]);
+            counted += calendar.advance_business_days(starts[i], 20).serial();
+        }
+    });
+    std::printf("%-32s %9.2f ns/pair\n", "business days, day by day", 1e9 * step_seconds / pairs);
+    std::printf("%-32s %9.2f ns/pair  %.0fx  (%s)\n", "business days, bitset Calendar", 1e9 * table_seconds / pairs,
+                step_seconds / table_seconds, stepped == counted ? "same" : "MISMATCH");
+    return 0;
+}
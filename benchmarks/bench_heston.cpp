@@ -0,0 +1,51 @@
+// Heston pricing: single-option Lewis integral (cold and cached maturity) against the COS strip,
+// and calibration to a 40-expiry x 30-strike surface.
+#include "Timer.hpp"
+#include "quant/pricing/Heston.hpp"
+#include "quant/pricing/ImpliedVol.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace quant::pricing;
+using namespace quant::instruments;
+
+int main() {
+    const HestonModel truth(0.035, 1.8, 0.05, 0.7, -0.6);
+    std::vector<double> strikes, tenors;
+    for (std::size_t i = 0; i < 30; ++i) strikes.push_back(60.0 + 3.0 * i);
+    for (std::size_t j = 0; j < 40; ++j) tenors.push_back(0.05 + 0.125 * j);
+
+    double sink = 0.0;
+    EuropeanOption opt(OptionType::Call, 100.0, 105.0, 1.0, 0.02, 0.0);
+    double cold = quant::bench::seconds_per_call([&] { sink += HestonEngine(truth).price(opt); });
+    HestonEngine engine(truth);
+    double cached = quant::bench::seconds_per_call([&] { sink += engine.price(opt); });
+    std::vector<double> strip(strikes.size());
+    double cold_strip = quant::bench::seconds_per_call([&] {
+        HestonEngine(truth).price_strip(OptionType::Call, 100.0, 1.0, 0.02, 0.0, strikes, strip);
+        sink += strip[0];
+    });
+    std::printf("single option: %.1f us cold, %.2f us cached maturity\n", 1e6 * cold, 1e6 * cached);
+    std::printf("%zu-strike COS strip: %.1f us cold (%.2f us/strike)\n", strikes.size(), 1e6 * cold_strip,
+                1e6 * cold_strip / strikes.size());
+
+    std::vector<std::vector<double>> prices(strikes.size(), std::vector<double>(tenors.size()));
+    for (std::size_t j = 0; j < tenors.size(); ++j) {
+        engine.price_strip(OptionType::Call, 100.0, tenors[j], 0.02, 0.0, strikes, strip);
+        for (std::size_t i = 0; i < strikes.size(); ++i) prices[i][j] = strip[i];
+    }
+    auto surface = implied_vol_surface(strikes, tenors, prices, OptionType::Call, 100.0, 0.02);
+    for (std::size_t threads : {std::size_t{1}, std::size_t{0}}) {
+        HestonCalibrationSettings settings;
+        settings.threads = threads;
+        quant::bench::Timer timer;
+        auto fit = calibrate_heston(surface, 100.0, 0.02, 0.0, settings);
+        std::printf("calibrate 40 x 30 (threads=%zu): %.3f s, %zu iterations, rmse %.2e, "
+                    "v0 %.4f kappa %.3f theta %.4f sigma %.3f rho %.3f\n",
+                    threads, timer.seconds(), fit.iterations, fit.rmse, fit.model.v0(), fit.model.kappa(),
+                    fit.model.theta(), fit.model.sigma(), fit.model.rho());
+    }
+    return sink == 42.0;
+}
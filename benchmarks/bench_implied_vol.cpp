@@ -0,0 +1,61 @@
+// Implied-vol throughput: inverts a 100k-quote strike x tenor grid and reports quotes/second.
+#include "Timer.hpp"
+#include "quant/core/Parallel.hpp"
+#include "quant/pricing/BlackScholesBatch.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
+#include "quant/pricing/ImpliedVol.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace quant::pricing;
+using quant::instruments::OptionType;
+
+int main() {
+    const double spot = 100.0, rate = 0.03, dividend = 0.01;
+    const std::size_t n_strikes = 2000, n_tenors = 50;
+
+    std::vector<double> strikes(n_strikes), tenors(n_tenors);
+    for (std::size_t i = 0; i < n_strikes; ++i) strikes[i] = 40.0 + 120.0 * static_cast<double>(i) / n_strikes;
+    for (std::size_t j = 0; j < n_tenors; ++j) tenors[j] = 0.02 + 0.1 * static_cast<double>(j);
+
+    OptionChain chain;
+    chain.reserve(n_strikes * n_tenors);
+    for (double k : strikes) {
+        for (double t : tenors) {
+            double m = std::log(k / spot);
+            double vol = 0.2 - 0.1 * m + 0.3 * m * m + 0.02 / std::sqrt(t + 0.1);
+            chain.push_back(k < spot ? OptionType::Put : OptionType::Call, spot, k, t, rate, vol, dividend);
+        }
+    }
+    auto view = chain.view();
+    std::vector<double> prices(chain.size()), vols(chain.size());
+    BlackScholesBatchEngine().price(view, prices);
+
+    std::printf("quotes: %zu, hardware threads: %zu\n", chain.size(), quant::core::hardware_threads());
+    for (std::size_t threads : {std::size_t{1}, std::size_t{0}}) {
+        ImpliedVolSolver solver(1e-12, 16, threads);
+        double sec = quant::bench::seconds_per_call([&] { solver.solve(view, prices, vols); }, 0.5);
+        double max_err = 0.0;
+        for (std::size_t i = 0; i < vols.size(); ++i) max_err = std::max(max_err, std::fabs(vols[i] - view.vol[i]));
+        std::printf("threads=%-3s  %8.2f ms/chain  %12.0f quotes/s  max |vol err| %.2e\n",
+                    threads == 0 ? "all" : "1", 1e3 * sec, static_cast<double>(chain.size()) / sec, max_err);
+    }
+
+    std::vector<std::vector<double>> grid(n_strikes, std::vector<double>(n_tenors));
+    for (std::size_t i = 0; i < n_strikes; ++i) {
+        for (std::size_t j = 0; j < n_tenors; ++j) {
+            grid[i][j] = black_scholes<BSPrice>(OptionType::Call, spot, strikes[i], tenors[j], rate, dividend,
+                                                view.vol[i * n_tenors + j]).price;
+        }
+    }
+    double sec = quant::bench::seconds_per_call([&] {
+        auto surface = implied_vol_surface(strikes, tenors, grid, OptionType::Call, spot, rate, dividend);
+        (void)surface;
+    }, 0.5);
+    std::printf("implied_vol_surface (call quotes): %8.2f ms  %12.0f quotes/s\n", 1e3 * sec,
+                static_cast<double>(chain.size()) / sec);
+    return 0;
+}
@@ -0,0 +1,56 @@
+// Lattice error vs time: the CRR barrier tree against the barrier-aligned lattice engine, and
+// American puts with and without Richardson extrapolation.
+#include "Timer.hpp"
+#include "quant/pricing/BarrierOption.hpp"
+#include "quant/pricing/Lattice.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace quant::pricing;
+using namespace quant::instruments;
+
+namespace {
+template <typename Engine, typename Option>
+void report(const char* name, std::size_t steps, const Engine& engine, const Option& opt, double exact) {
+    double value = 0.0;
+    double sec = quant::bench::seconds_per_call([&] { value = engine.price(opt); }, 0.1);
+    std::printf("%-22s %6zu %12.2e %12.1f\n", name, steps, std::fabs(value - exact), 1e6 * sec);
+}
+}
+
+int main() {
+    BarrierOption barrier(BarrierType::DownAndOut, OptionType::Call, 100.0, 100.0, 1.0, 0.02, 0.25, 85.0, 1.0);
+    const double exact = AnalyticBarrierEngine().price(barrier);
+    std::printf("down-and-out call, closed form %.6f\n", exact);
+    std::printf("%-22s %6s %12s %12s\n", "engine", "steps", "abs err", "us/price");
+    for (std::size_t steps : {200, 1000, 4000}) report("CRR tree", steps, BarrierOptionEngine(steps), barrier, exact);
+    for (LatticeType type : {LatticeType::Binomial, LatticeType::Trinomial}) {
+        for (std::size_t steps : {25, 50, 100, 200, 400}) {
+            LatticeSettings s;
+            s.type = type;
+            s.steps = steps;
+            report(type == LatticeType::Binomial ? "binomial (aligned)" : "trinomial (aligned)", steps,
+                   LatticeEngine(s), barrier, exact);
+        }
+    }
+
+    EuropeanOption put(OptionType::Put, 100.0, 100.0, 1.0, 0.05, 0.3);
+    LatticeSettings ref;
+    ref.steps = 10000;
+    ref.exercise = ExerciseStyle::American;
+    ref.richardson = true;
+    const double american = LatticeEngine(ref).price(put);
+    std::printf("\nAmerican put, reference %.6f\n", american);
+    std::printf("%-22s %6s %12s %12s\n", "engine", "steps", "abs err", "us/price");
+    for (bool richardson : {false, true}) {
+        for (std::size_t steps : {50, 100, 200, 400, 800}) {
+            LatticeSettings s;
+            s.steps = steps;
+            s.exercise = ExerciseStyle::American;
+            s.richardson = richardson;
+            report(richardson ? "trinomial+richardson" : "trinomial", steps, LatticeEngine(s), put, american);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+// Curve/surface lookup cost: MarketData's string-keyed maps against interned handles on a
+// MarketDataStore snapshot, loading the snapshot per lookup or through a MarketReader, and the
+// cost of publishing a new version.
+#include "Timer.hpp"
+#include "quant/market/MarketData.hpp"
+#include "quant/market/MarketSnapshot.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace quant::market;
+
+int main() {
+    constexpr std::size_t n = 500;
+    const char* ccys[] = {"USD", "EUR", "GBP", "JPY", "CHF"};
+    MarketData data;
+    MarketDataStore store;
+    std::vector<std::string> names;
+    std::vector<CurveHandle> handles;
+    auto update = store.update();
+    for (std::size_t i = 0; i < n; ++i) {
+        names.push_back(std::string(ccys[i % 5]) + ".SWAP.CURVE." + std::to_string(i));
+        YieldCurve curve({0.5, 1.0, 5.0, 10.0}, {0.03, 0.031, 0.033, 0.034});
+        data.add_yield_curve(names.back(), curve);
+        handles.push_back(store.curve_handle(names.back()));
+        update.set(handles.back(), curve);
+    }
+    update.commit();
+    // Lookup order that defeats any single hot entry.
+    std::vector<std::size_t> order(4096);
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = (i * 7919) % n;
+    std::printf("%zu curves, %zu lookups per pass\n", n, order.size());
+
+    std::size_t sink = 0;
+    auto report = [&](const char* label, double seconds) {
+        std::printf("%-36s %7.2f ns/lookup\n", label, 1e9 * seconds / static_cast<double>(order.size()));
+    };
+    report("MarketData string map", quant::bench::seconds_per_call([&] {
+               for (std::size_t i : order) sink += data.yield_curve(names[i]) != nullptr;
+           }));
+    report("snapshot() per lookup + handle", quant::bench::seconds_per_call([&] {
+               for (std::size_t i : order) sink += store.snapshot()->yield_curve(handles[i]) != nullptr;
+           }));
+    MarketReader reader(store);
+    report("MarketReader::current() + handle", quant::bench::seconds_per_call([&] {
+               for (std::size_t i : order) sink += reader.current().yield_curve(handles[i]) != nullptr;
+           }));
+    auto snapshot = store.snapshot();
+    report("pinned snapshot + handle", quant::bench::seconds_per_call([&] {
+               for (std::size_t i : order) sink += snapshot->yield_curve(handles[i]) != nullptr;
+           }));
+
+    YieldCurve tick({0.5, 1.0, 5.0, 10.0}, {0.0301, 0.0311, 0.0331, 0.0341});
+    double publish = quant::bench::seconds_per_call([&] { store.publish(handles[sink % n], tick); });
+    std::printf("%-36s %7.2f us (copies %zu curve pointers)\n", "publish one curve", 1e6 * publish, n);
+    std::printf("checksum %zu\n", sink);
+    return 0;
+}
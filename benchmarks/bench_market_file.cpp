@@ -0,0 +1,114 @@
+// Startup load of 10k curves and 10k surfaces: parsing a text file through the YieldCurve and
+// VolSurface constructors against mapping a MarketDataFile snapshot, with and without the
+// checksum pass. Both files are in the page cache, so this is the cost a fresh process pays on
+// top of reading the pages.
+#include "Timer.hpp"
+#include "quant/market/MarketDataFile.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace quant::market;
+
+namespace {
+MarketData load_text(const std::string& path) {
+    MarketData data;
+    std::ifstream in(path);
+    std::string kind, name;
+    int interpolation = 0;
+    std::size_t n = 0, m = 0;
+    while (in >> kind >> name >> interpolation) {
+        if (kind == "curve") {
+            in >> n;
+            std::vector<double> times(n), rates(n);
+            for (double& t : times) in >> t;
+            for (double& r : rates) in >> r;
+            data.add_yield_curve(name, YieldCurve(std::move(times), std::move(rates),
+                                                  static_cast<CurveInterpolation>(interpolation)));
+        } else {
+            in >> n >> m;
+            std::vector<double> strikes(n), tenors(m), vols(n * m);
+            for (double& k : strikes) in >> k;
+            for (double& t : tenors) in >> t;
+            for (double& v : vols) in >> v;
+            data.add_vol_surface(name, VolSurface(std::move(strikes), std::move(tenors), std::move(vols),
+                                                  static_cast<VolInterpolation>(interpolation)));
+        }
+    }
+    return data;
+}
+}
+
+int main() {
+    const int curves = 10000, surfaces = 10000;
+    const std::vector<double> times{0.083, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 15.0, 20.0, 25.0, 30.0};
+    const std::vector<double> strikes{50, 60, 70, 80, 90, 95, 100, 105, 110, 120, 130, 140, 150, 175, 200};
+    const std::vector<double> tenors{0.08, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 10.0};
+    const auto dir = std::filesystem::temp_directory_path();
+    const std::string text_path = (dir / "bench_market_file.txt").string();
+    const std::string binary_path = (dir / "bench_market_file.qmd").string();
+
+    MarketData data;
+    {
+        std::ofstream text(text_path);
+        text.precision(17);
+        for (int c = 0; c < curves; ++c) {
+            std::string name = "curve" + std::to_string(c);
+            std::vector<double> rates;
+            for (double t : times) rates.push_back(0.02 + 0.0001 * (c % 100) + 0.004 * std::log1p(t));
+            text << "curve " << name << ' ' << c % 3 << ' ' << times.size();
+            for (double t : times) text << ' ' << t;
+            for (double r : rates) text << ' ' << r;
+            text << '\n';
+            data.add_yield_curve(name, YieldCurve(times, rates, static_cast<CurveInterpolation>(c % 3)));
+        }
+        for (int s = 0; s < surfaces; ++s) {
+            std::string name = "surface" + std::to_string(s);
+            std::vector<double> vols;
+            for (double k : strikes) {
+                for (double t : tenors) vols.push_back(0.15 + 0.001 * (s % 50) + 0.3 * std::pow(std::log(k / 100.0), 2) / (1 + t));
+            }
+            text << "surface " << name << ' ' << s % 3 << ' ' << strikes.size() << ' ' << tenors.size();
+            for (double k : strikes) text << ' ' << k;
+            for (double t : tenors) text << ' ' << t;
+            for (double v : vols) text << ' ' << v;
+            text << '\n';
+            data.add_vol_surface(name, VolSurface(strikes, tenors, vols, static_cast<VolInterpolation>(s % 3)));
+        }
+    }
+    quant::bench::Timer write_timer;
+    MarketDataFile::write(data, binary_path);
+    const double write_seconds = write_timer.seconds();
+    std::printf("%d curves (%zu pillars), %d surfaces (%zu x %zu); text %.1f MB, snapshot %.1f MB, written in %.1f ms\n",
+                curves, times.size(), surfaces, strikes.size(), tenors.size(),
+                std::filesystem::file_size(text_path) / 1e6, std::filesystem::file_size(binary_path) / 1e6,
+                1e3 * write_seconds);
+
+    double check = 0.0;
+    auto probe = [&](const MarketData& d) {
+        check += d.yield_curve("curve4321")->discount(7.5) + d.vol_surface("surface1234")->volatility(97.0, 1.5);
+    };
+    double text_seconds = quant::bench::seconds_per_call([&] { probe(load_text(text_path)); }, 1.0);
+    double mapped_seconds = quant::bench::seconds_per_call([&] { probe(MarketDataFile::map(binary_path)); });
+    double unverified_seconds = quant::bench::seconds_per_call([&] { probe(MarketDataFile::map(binary_path, false)); });
+    std::printf("%-28s %9.2f ms/load\n", "text + constructors", 1e3 * text_seconds);
+    std::printf("%-28s %9.2f ms/load  (%.0fx)\n", "mapped, checksum verified", 1e3 * mapped_seconds,
+                text_seconds / mapped_seconds);
+    std::printf("%-28s %9.2f ms/load  (%.0fx)\n", "mapped, unverified", 1e3 * unverified_seconds,
+                text_seconds / unverified_seconds);
+
+    MarketData text = load_text(text_path), mapped = MarketDataFile::map(binary_path);
+    double diff = 0.0;
+    for (int c = 0; c < curves; c += 97) {
+        std::string name = "curve" + std::to_string(c);
+        diff = std::max(diff, std::abs(text.yield_curve(name)->discount(4.2) - mapped.yield_curve(name)->discount(4.2)));
+    }
+    std::printf("max |text - mapped| discount %.3g, checksum %.6f\n", diff, check);
+    std::filesystem::remove(text_path);
+    std::filesystem::remove(binary_path);
+    return 0;
+}
@@ -0,0 +1,53 @@
+// Quasi- vs pseudo-random convergence: RMSE over independent seeds against wall-clock time per price.
+#include "Timer.hpp"
+#include "quant/pricing/MonteCarlo.hpp"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace quant::pricing;
+using namespace quant::instruments;
+
+int main() {
+    BarrierOption barrier(BarrierType::UpAndOut, OptionType::Call, 100.0, 100.0, 1.0, 0.01, 0.2, 130.0);
+    constexpr std::size_t steps = 64;
+    constexpr std::uint64_t replications = 16;
+
+    MonteCarloSettings reference;
+    reference.paths = 1 << 21;
+    reference.steps = steps;
+    reference.generator = PathGenerator::SobolBrownianBridge;
+    const double target = MonteCarloEngine(reference).price(barrier);
+    std::printf("reference (%zu Sobol+bridge paths): %.6f\n\n", reference.paths, target);
+
+    struct Case {
+        const char* name;
+        PathGenerator generator;
+    };
+    const Case cases[] = {
+        {"pseudo-random", PathGenerator::PseudoRandom},
+        {"sobol", PathGenerator::Sobol},
+        {"sobol + bridge", PathGenerator::SobolBrownianBridge},
+    };
+    std::printf("%-16s %8s %12s %12s\n", "generator", "paths", "rmse", "ms/price");
+    for (const auto& c : cases) {
+        for (std::size_t paths = 1 << 10; paths <= (1 << 16); paths <<= 2) {
+            MonteCarloSettings s;
+            s.paths = paths;
+            s.steps = steps;
+            s.generator = c.generator;
+            double sq = 0.0;
+            double sec = 0.0;
+            for (std::uint64_t seed = 1; seed <= replications; ++seed) {
+                s.seed = seed;
+                MonteCarloEngine engine(s);
+                double price = 0.0;
+                sec += quant::bench::seconds_per_call([&] { price = engine.price(barrier); }, 0.0);
+                sq += (price - target) * (price - target);
+            }
+            std::printf("%-16s %8zu %12.6f %12.3f\n", c.name, paths, std::sqrt(sq / replications),
+                        1e3 * sec / replications);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+// SABR smile throughput (scalar vs vectorised strip) and calibration of a cube of
+// underlyings x expiries x strikes, one Levenberg-Marquardt fit per expiry slice.
+#include "Timer.hpp"
+#include "quant/pricing/SABR.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace quant::pricing;
+
+int main() {
+    constexpr std::size_t underlyings = 300, expiries = 40, strikes = 30;
+
+    SABRModel model(0.3, 0.5, -0.25, 0.45);
+    std::vector<double> k(strikes), v(strikes);
+    for (std::size_t i = 0; i < strikes; ++i) k[i] = 100.0 * std::exp(-0.5 + i / (strikes - 1.0));
+    double sink = 0.0;
+    double scalar = quant::bench::seconds_per_call([&] {
+        for (std::size_t i = 0; i < strikes; ++i) sink += model.implied_vol(100.0, k[i], 1.0);
+    });
+    double strip = quant::bench::seconds_per_call([&] {
+        model.implied_vols(100.0, 1.0, k, v);
+        sink += v[0];
+    });
+    std::printf("%zu-strike smile: scalar %.1f ns/vol, strip %.1f ns/vol\n", strikes, 1e9 * scalar / strikes,
+                1e9 * strip / strikes);
+
+    std::vector<SABRSmile> cube;
+    cube.reserve(underlyings * expiries);
+    for (std::size_t u = 0; u < underlyings; ++u) {
+        for (std::size_t e = 0; e < expiries; ++e) {
+            double T = 0.05 + 0.25 * e;
+            double F = (50.0 + u) * std::exp(0.02 * T);
+            SABRModel truth(0.2 * std::sqrt(F) * (1.0 + 0.001 * u), 0.5, -0.5 + 0.02 * e, 0.9 / (1.0 + 0.1 * T));
+            SABRSmile smile{F, T, std::vector<double>(strikes), std::vector<double>(strikes), {}};
+            double width = 0.3 * std::sqrt(T) + 0.1;
+            for (std::size_t i = 0; i < strikes; ++i) smile.strikes[i] = F * std::exp(width * (2.0 * i / (strikes - 1.0) - 1.0));
+            truth.implied_vols(F, T, smile.strikes, smile.vols);
+            for (std::size_t i = 0; i < strikes; ++i) smile.vols[i] += 2e-4 * std::sin(1.7 * i + u + e); // quote noise
+            cube.push_back(std::move(smile));
+        }
+    }
+
+    for (std::size_t threads : {std::size_t{1}, std::size_t{0}}) {
+        SABRCalibrationSettings settings;
+        settings.threads = threads;
+        quant::bench::Timer timer;
+        auto fits = calibrate_sabr(cube, settings);
+        double sec = timer.seconds();
+        double worst = 0.0;
+        std::size_t converged = 0;
+        for (const auto& f : fits) {
+            worst = std::max(worst, f.rmse);
+            converged += f.converged;
+        }
+        std::printf("calibrate %zu x %zu x %zu (threads=%zu): %.3f s, %zu/%zu converged, worst rmse %.2e\n",
+                    underlyings, expiries, strikes, threads, sec, converged, fits.size(), worst);
+    }
+    return sink == 42.0;
+}
@@ -0,0 +1,100 @@
+// Scenario revaluation of a swap book: a shocked copy of the curve and of every swap per scenario
+// against ScenarioEngine reading the base curve through ShiftedYieldCurve, with heap allocations
+// counted per scenario. The views path allocates nothing now that swaps price from compiled
+// cashflow tables.
+#include "Timer.hpp"
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/YieldCurve.hpp"
+#include "quant/pricing/DiscountingSwap.hpp"
+#include "quant/risk/Scenario.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::market;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+namespace {
+std::atomic<long> allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+int main() {
+    const std::vector<double> times{0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 15.0, 20.0, 30.0};
+    const std::vector<double> rates{0.031, 0.0318, 0.0325, 0.0331, 0.0336, 0.0342, 0.0347, 0.0351, 0.0355, 0.0357, 0.0358};
+    YieldCurve curve(times, rates);
+    quant::pricing::DiscountingSwapEngine engine;
+    std::vector<std::shared_ptr<Instrument>> book;
+    for (int y = 1; y <= 10; ++y) {
+        Schedule fixed{Date(2024, 1, 15), Date(2024 + y, 1, 15), Frequency::Annual};
+        Schedule floating{Date(2024, 1, 15), Date(2024 + y, 1, 15), Frequency::Quarterly};
+        book.push_back(std::make_shared<VanillaSwap>(SwapType::Payer, 1e6, 0.034, fixed, floating,
+                                                     DayCountConvention::ACT_365, DayCountConvention::ACT_360,
+                                                     &curve));
+    }
+    const int scenarios = 10000;
+    auto shock_of = [](int i) {
+        quant::risk::ScenarioShock shock;
+        shock.rate_parallel_bp = -50.0 + 100.0 * i / scenarios;
+        shock.curve_shift.twist = 1e-5 * (i % 7 - 3);
+        shock.curve_shift.pivot = 5.0;
+        return shock;
+    };
+
+    // What the engine did before the views: rebuild the shocked curve and every swap on it.
+    auto copy_pnl = [&](const quant::risk::ScenarioShock& shock) {
+        double pnl = 0.0;
+        for (const auto& inst : book) {
+            const auto& swap = static_cast<const VanillaSwap&>(*inst);
+            std::vector<double> shocked_rates(curve.zero_rates().begin(), curve.zero_rates().end());
+            for (std::size_t k = 0; k < shocked_rates.size(); ++k) {
+                double t = curve.times()[k];
+                shocked_rates[k] += shock.rate_parallel_bp / 10000.0 + shock.curve_shift(t);
+            }
+            YieldCurve shocked_curve({curve.times().begin(), curve.times().end()}, shocked_rates, curve.interpolation());
+            VanillaSwap shocked_swap(swap.type(), swap.notional(), swap.fixed_rate(), swap.fixed_schedule(),
+                                     swap.float_schedule(), swap.fixed_dcc(), swap.float_dcc(), &shocked_curve,
+                                     swap.float_spread());
+            pnl += engine.price(shocked_swap) - engine.price(swap);
+        }
+        return pnl;
+    };
+    quant::risk::ScenarioEngine scenario_engine(engine, &curve, nullptr);
+
+    std::printf("%d scenarios (parallel + twist) over %zu swaps, 1-10y\n", scenarios, book.size());
+    double check = 0.0;
+    for (int pass = 0; pass < 2; ++pass) {
+        long before = allocations.load();
+        quant::bench::Timer timer;
+        double total = 0.0;
+        for (int i = 0; i < scenarios; ++i) {
+            auto shock = shock_of(i);
+            total += pass == 0 ? copy_pnl(shock) : scenario_engine.apply(book, shock);
+        }
+        double seconds = timer.seconds();
+        long count = allocations.load() - before;
+        std::printf("%-28s %8.2f us/scenario  %7.1f allocations/scenario  (sum %.6e)\n",
+                    pass == 0 ? "shocked copies" : "ScenarioEngine (views)", 1e6 * seconds / scenarios,
+                    static_cast<double>(count) / scenarios, total);
+        check = pass == 0 ? total : std::abs(total - check) / std::abs(check);
+    }
+    long before = allocations.load();
+    for (const auto& inst : book) inst->npv();
+    std::printf("VanillaSwap::npv: %ld allocations per book valuation\n",
+                allocations.load() - before);
+    std::printf("relative difference %.2e\n", check);
+    return 0;
+}
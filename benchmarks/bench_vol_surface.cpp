@@ -0,0 +1,97 @@
+// Vol lookups on a 40 x 30 surface: the nested-vector grid with two binary searches and per-call
+// weights (the previous VolSurface) against the flat grid, the hinted batch API and a tenor
+// slice, for each interpolation mode, plus EuropeanOption::npv with the surface attached.
+#include "Timer.hpp"
+#include "quant/instruments/EuropeanOption.hpp"
+#include "quant/market/VolSurface.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using quant::market::VolInterpolation;
+using quant::market::VolSurface;
+
+namespace {
+struct NestedSurface {
+    std::vector<double> strikes, tenors;
+    std::vector<std::vector<double>> vols;
+    double volatility(double strike, double tenor) const {
+        auto itK = std::upper_bound(strikes.begin(), strikes.end(), strike);
+        auto itT = std::upper_bound(tenors.begin(), tenors.end(), tenor);
+        std::size_t k1 = itK == strikes.begin() ? 0 : static_cast<std::size_t>(itK - strikes.begin() - 1);
+        std::size_t k2 = itK == strikes.end() ? strikes.size() - 1 : k1 + 1;
+        std::size_t t1 = itT == tenors.begin() ? 0 : static_cast<std::size_t>(itT - tenors.begin() - 1);
+        std::size_t t2 = itT == tenors.end() ? tenors.size() - 1 : t1 + 1;
+        double qk = strikes[k2] == strikes[k1] ? 0.0 : (strike - strikes[k1]) / (strikes[k2] - strikes[k1]);
+        double qt = tenors[t2] == tenors[t1] ? 0.0 : (tenor - tenors[t1]) / (tenors[t2] - tenors[t1]);
+        double v1 = vols[k1][t1] + qt * (vols[k1][t2] - vols[k1][t1]);
+        double v2 = vols[k2][t1] + qt * (vols[k2][t2] - vols[k2][t1]);
+        return v1 + qk * (v2 - v1);
+    }
+};
+}
+
+int main() {
+    std::vector<double> strikes, tenors;
+    for (int i = 0; i < 40; ++i) strikes.push_back(50.0 + 2.5 * i);
+    for (int j = 0; j < 30; ++j) tenors.push_back(0.05 + 0.1 * j * (1.0 + 0.1 * j));
+    std::vector<std::vector<double>> vols(strikes.size(), std::vector<double>(tenors.size()));
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+        for (std::size_t j = 0; j < tenors.size(); ++j) {
+            double m = std::log(strikes[i] / 100.0);
+            vols[i][j] = 0.2 + 0.03 * std::exp(-tenors[j]) + 0.3 * m * m / std::sqrt(1.0 + tenors[j]) - 0.05 * m;
+        }
+    }
+    // An option chain: 200 strikes at each of 25 expiries, sorted by expiry then strike.
+    std::vector<double> qk, qt, out;
+    for (int j = 0; j < 25; ++j) {
+        for (int i = 0; i < 200; ++i) {
+            qt.push_back(0.1 + 0.4 * j);
+            qk.push_back(55.0 + 0.45 * i);
+        }
+    }
+    const std::size_t n = qk.size();
+    out.resize(n);
+    std::printf("%zu x %zu grid, %zu queries (25 expiries x 200 strikes)\n", strikes.size(), tenors.size(), n);
+
+    NestedSurface nested{strikes, tenors, vols};
+    double sink = 0.0;
+    double ref_sec = quant::bench::seconds_per_call([&] {
+        for (std::size_t i = 0; i < n; ++i) sink += nested.volatility(qk[i], qt[i]);
+    });
+    std::printf("%-16s %-16s %6.1f ns/vol\n", "bilinear", "nested grid", 1e9 * ref_sec / n);
+
+    const char* names[] = {"bilinear", "variance linear", "bicubic"};
+    VolInterpolation modes[] = {VolInterpolation::Bilinear, VolInterpolation::VarianceLinear, VolInterpolation::Bicubic};
+    for (int m = 0; m < 3; ++m) {
+        VolSurface surface(strikes, tenors, vols, modes[m]);
+        double single = quant::bench::seconds_per_call([&] {
+            for (std::size_t i = 0; i < n; ++i) sink += surface.volatility(qk[i], qt[i]);
+        });
+        double batch = quant::bench::seconds_per_call([&] {
+            surface.volatility(qk, qt, out);
+            sink += out[n / 2];
+        });
+        double sliced = quant::bench::seconds_per_call([&] {
+            for (std::size_t j = 0; j < n; j += 200) {
+                auto slice = surface.slice(qt[j]);
+                slice.volatility(std::span<const double>(qk).subspan(j, 200), std::span<double>(out).subspan(j, 200));
+            }
+            sink += out[n / 2];
+        });
+        std::printf("%-16s %-16s %6.1f ns/vol\n", names[m], "flat grid", 1e9 * single / n);
+        std::printf("%-16s %-16s %6.1f ns/vol\n", names[m], "batch", 1e9 * batch / n);
+        std::printf("%-16s %-16s %6.1f ns/vol  (%.2fx vs nested grid)\n", names[m], "tenor slices", 1e9 * sliced / n,
+                    ref_sec / sliced);
+    }
+
+    VolSurface surface(strikes, tenors, vols);
+    quant::instruments::EuropeanOption opt(quant::instruments::OptionType::Call, 100.0, 105.0, 1.3, 0.03, 0.2);
+    opt.set_vol_surface(&surface);
+    double npv = quant::bench::seconds_per_call([&] { sink += opt.npv(); });
+    std::printf("%-33s %6.1f ns\n", "EuropeanOption::npv on surface", 1e9 * npv);
+    std::printf("checksum %.6f\n", sink);
+    return 0;
+}
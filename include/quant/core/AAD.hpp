@@ -0,0 +1,163 @@
+#pragma once
+
+#include "quant/core/Math.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace quant::core {
+
+class Real;
+
+// Reverse-mode AD tape. Every operation on active Reals appends one node holding its local
+// partials to at most two parents; nodes live in fixed-size blocks that are kept when the tape
+// is rewound, so a tape reused across trades stops allocating once it has seen the largest one.
+// Typical use: record the market inputs, mark(), then per trade evaluate, propagate() and
+// read adjoint() of the inputs before rewind(mark).
+class Tape {
+public:
+    static constexpr std::uint32_t npos = 0xFFFFFFFFu;
+
+    Tape() = default;
+    Tape(const Tape&) = delete;
+    Tape& operator=(const Tape&) = delete;
+
+    // New independent variable recorded on this tape.
+    Real input(double value);
+
+    std::size_t size() const { return size_; }
+    std::size_t mark() const { return size_; }
+    // Drops every node recorded after position; Reals recorded there must no longer be used.
+    void rewind(std::size_t position = 0) { size_ = position < size_ ? position : size_; }
+
+    // Reverse sweep seeded with d output / d output = 1; afterwards adjoint(x) = d output / d x.
+    void propagate(const Real& output);
+    double adjoint(const Real& x) const;
+
+    std::uint32_t record(std::uint32_t a, double da, std::uint32_t b = npos, double db = 0.0) {
+        if (size_ == capacity_) grow();
+        Node& n = blocks_[size_ >> kBlockBits][size_ & kBlockMask];
+        // Missing parents point at the node itself with a zero partial, keeping the sweep branch-free.
+        const auto self = static_cast<std::uint32_t>(size_);
+        n = {{da, db}, {a == npos ? self : a, b == npos ? self : b}};
+        return static_cast<std::uint32_t>(size_++);
+    }
+
+private:
+    struct Node {
+        double partial[2];
+        std::uint32_t parent[2];
+    };
+    static constexpr std::size_t kBlockBits = 16;
+    static constexpr std::size_t kBlockMask = (std::size_t{1} << kBlockBits) - 1;
+
+    void grow();
+
+    std::vector<std::unique_ptr<Node[]>> blocks_;
+    std::size_t size_{0};
+    std::size_t capacity_{0};
+    std::vector<double> adjoints_;
+};
+
+// The tape active Reals record on; one per thread.
+inline thread_local Tape* active_tape = nullptr;
+
+// Makes a tape active for the lifetime of the guard.
+class ActiveTape {
+public:
+    explicit ActiveTape(Tape& tape) : previous_(active_tape) { active_tape = &tape; }
+    ~ActiveTape() { active_tape = previous_; }
+    ActiveTape(const ActiveTape&) = delete;
+    ActiveTape& operator=(const ActiveTape&) = delete;
+
+private:
+    Tape* previous_;
+};
+
+// Active double for reverse-mode AD. Reals built from doubles are constants and are never
+// recorded; operations involving at least one active operand record on the active tape.
+class Real {
+public:
+    Real(double value = 0.0) : value_(value) {}
+
+    double value() const { return value_; }
+    std::uint32_t index() const { return index_; }
+    bool active() const { return index_ != Tape::npos; }
+
+    // Result of an operation with partials da, db to its operands.
+    static Real make(double value, const Real& a, double da) {
+        return a.active() ? Real(value, active_tape->record(a.index_, da)) : Real(value);
+    }
+    static Real make(double value, const Real& a, double da, const Real& b, double db) {
+        if (!a.active()) return make(value, b, db);
+        if (!b.active()) return Real(value, active_tape->record(a.index_, da));
+        return Real(value, active_tape->record(a.index_, da, b.index_, db));
+    }
+
+    Real& operator+=(const Real& b) { return *this = *this + b; }
+    Real& operator-=(const Real& b) { return *this = *this - b; }
+    Real& operator*=(const Real& b) { return *this = *this * b; }
+    Real& operator/=(const Real& b) { return *this = *this / b; }
+
+    friend Real operator+(const Real& a, const Real& b) { return make(a.value_ + b.value_, a, 1.0, b, 1.0); }
+    friend Real operator-(const Real& a, const Real& b) { return make(a.value_ - b.value_, a, 1.0, b, -1.0); }
+    friend Real operator*(const Real& a, const Real& b) { return make(a.value_ * b.value_, a, b.value_, b, a.value_); }
+    friend Real operator/(const Real& a, const Real& b) {
+        double inv = 1.0 / b.value_;
+        double q = a.value_ * inv;
+        return make(q, a, inv, b, -q * inv);
+    }
+    friend Real operator-(const Real& a) { return make(-a.value_, a, -1.0); }
+    friend Real operator+(const Real& a) { return a; }
+
+    friend bool operator<(const Real& a, const Real& b) { return a.value_ < b.value_; }
+    friend bool operator<=(const Real& a, const Real& b) { return a.value_ <= b.value_; }
+    friend bool operator>(const Real& a, const Real& b) { return a.value_ > b.value_; }
+    friend bool operator>=(const Real& a, const Real& b) { return a.value_ >= b.value_; }
+    friend bool operator==(const Real& a, const Real& b) { return a.value_ == b.value_; }
+    friend bool operator!=(const Real& a, const Real& b) { return a.value_ != b.value_; }
+
+    friend Real exp(const Real& a) {
+        double e = std::exp(a.value_);
+        return make(e, a, e);
+    }
+    friend Real log(const Real& a) { return make(std::log(a.value_), a, 1.0 / a.value_); }
+    friend Real sqrt(const Real& a) {
+        double s = std::sqrt(a.value_);
+        return make(s, a, 0.5 / s);
+    }
+    friend Real abs(const Real& a) { return make(std::fabs(a.value_), a, a.value_ < 0.0 ? -1.0 : 1.0); }
+    friend Real fabs(const Real& a) { return abs(a); }
+    friend Real pow(const Real& a, double p) {
+        double v = std::pow(a.value_, p);
+        return make(v, a, p * std::pow(a.value_, p - 1.0));
+    }
+    friend Real norm_cdf(const Real& a) {
+        return make(quant::core::norm_cdf(a.value_), a, quant::core::norm_pdf(a.value_));
+    }
+    friend Real norm_pdf(const Real& a) {
+        double p = quant::core::norm_pdf(a.value_);
+        return make(p, a, -a.value_ * p);
+    }
+
+private:
+    friend class Tape;
+    Real(double value, std::uint32_t index) : value_(value), index_(index) {}
+
+    double value_;
+    std::uint32_t index_{Tape::npos};
+};
+
+inline Real Tape::input(double value) { return Real(value, record(npos, 0.0)); }
+
+template <>
+struct scalar_type<Real> {
+    using type = double;
+};
+
+inline double value_of(const Real& x) { return x.value(); }
+
+} // namespace quant::core
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace quant::core {
+
+// Brownian-bridge path construction: the first normal fixes the terminal point, later ones fill
+// in successive midpoints, so low-discrepancy dimensions land on the largest-variance directions.
+class BrownianBridge {
+public:
+    explicit BrownianBridge(std::size_t steps); // unit time steps
+    explicit BrownianBridge(std::vector<double> times);
+
+    std::size_t size() const { return times_.size(); }
+
+    // Maps size() standard normals to Brownian increments W(t_i) - W(t_{i-1}).
+    void transform(const double* normals, double* increments) const;
+
+private:
+    void initialize();
+
+    std::vector<double> times_;
+    std::vector<std::size_t> bridge_index_;
+    std::vector<std::size_t> left_index_;
+    std::vector<std::size_t> right_index_;
+    std::vector<double> left_weight_;
+    std::vector<double> right_weight_;
+    std::vector<double> stddev_;
+};
+
+} // namespace quant::core
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace quant::core {
+
+// A contiguous array that owns its elements or borrows read-only memory, e.g. a mapped file,
+// together with a keep-alive handle that every copy of the Buffer shares. Reads go through one
+// cached pointer either way; the mutators copy a borrowed array into owned storage first.
+template <typename T>
+class Buffer {
+public:
+    Buffer() = default;
+    Buffer(std::vector<T> values) : owned_(std::move(values)) { sync(); }
+    Buffer(const Buffer& other) : owned_(other.owned_) {
+        if (other.borrowed()) {
+            data_ = other.data_;
+            size_ = other.size_;
+            keep_ = other.keep_;
+        } else {
+            sync();
+        }
+    }
+    Buffer(Buffer&& other) noexcept { *this = std::move(other); }
+    Buffer& operator=(const Buffer& other) {
+        if (this != &other) *this = Buffer(other);
+        return *this;
+    }
+    Buffer& operator=(Buffer&& other) noexcept {
+        if (this == &other) return *this;
+        const bool borrowed = other.borrowed();
+        owned_ = std::move(other.owned_);
+        keep_ = std::move(other.keep_);
+        if (borrowed) {
+            data_ = other.data_;
+            size_ = other.size_;
+        } else {
+            sync();
+        }
+        other.owned_.clear();
+        other.sync();
+        return *this;
+    }
+
+    // values stay valid for as long as keep_alive, held by this Buffer and its copies, is alive.
+    static Buffer borrow(std::span<const T> values, std::shared_ptr<const void> keep_alive) {
+        Buffer b;
+        b.data_ = values.data();
+        b.size_ = values.size();
+        b.keep_ = std::move(keep_alive);
+        return b;
+    }
+
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool borrowed() const { return size_ != 0 && data_ != owned_.data(); }
+    const T* data() const { return data_; }
+    const T* begin() const { return data_; }
+    const T* end() const { return data_ + size_; }
+    const T& operator[](std::size_t i) const { return data_[i]; }
+    const T& front() const { return data_[0]; }
+    const T& back() const { return data_[size_ - 1]; }
+    std::span<const T> span() const { return {data_, size_}; }
+    operator std::span<const T>() const { return span(); }
+
+    // The elements, writable in place.
+    T* edit() {
+        own();
+        return owned_.data();
+    }
+    void assign(std::size_t n, const T& value) {
+        owned_.assign(n, value);
+        sync();
+    }
+    void resize(std::size_t n) {
+        own();
+        owned_.resize(n);
+        sync();
+    }
+
+private:
+    void own() {
+        if (!borrowed()) return;
+        owned_.assign(data_, data_ + size_);
+        sync();
+    }
+    void sync() {
+        data_ = owned_.data();
+        size_ = owned_.size();
+        keep_.reset();
+    }
+
+    std::vector<T> owned_;
+    std::shared_ptr<const void> keep_;
+    const T* data_{nullptr};
+    std::size_t size_{0};
+};
+
+} // namespace quant::core
@@ -1,7 +1,12 @@
 #pragma once
 
+#include "quant/core/Exceptions.hpp"
+
+#include <bit>
 #include <chrono>
 #include <compare>
+#include <cstddef>
+#include <cstdint>
 #include <set>
 #include <string>
 #include <vector>
@@ -14,25 +19,96 @@ enum class DayCountConvention {
     THIRTY_360
 };
 
+struct CivilDate {
+    int year;
+    unsigned month;
+    unsigned day;
+};
+
+constexpr bool is_leap_year(int y) { return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0; }
+
+constexpr unsigned days_in_month(int y, unsigned m) {
+    constexpr unsigned days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return m == 2 && is_leap_year(y) ? 29 : days[m - 1];
+}
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar and back (Hinnant's algorithms:
+// 400-year eras starting on 1 March, so the leap day ends the year).
+constexpr int days_from_civil(int y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const auto yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int>(doe) - 719468;
+}
+
+constexpr CivilDate civil_from_days(int z) {
+    z += 719468;
+    const int era = (z >= 0 ? z : z - 146096) / 146097;
+    const auto doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    const unsigned d = doy - (153 * mp + 2) / 5 + 1;
+    const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+    return {static_cast<int>(yoe) + era * 400 + (m <= 2), m, d};
+}
+
+// Calendar date held as a serial day number (days since 1970-01-01), so comparisons, day
+// counts and day arithmetic are integer operations with no time zone involved.
 class Date {
 public:
-    Date() = default;
-    Date(int y, unsigned m, unsigned d);
-
-    int year() const { return year_; }
-    unsigned month() const { return month_; }
-    unsigned day() const { return day_; }
-
+    constexpr Date() = default;
+    constexpr Date(int y, unsigned m, unsigned d) : serial_(days_from_civil(y, m, d)) {
+        if (m < 1 || m > 12 || d < 1 || d > days_in_month(y, m)) throw DataError("Invalid date");
+    }
+    static constexpr Date from_serial(int serial) {
+        Date d;
+        d.serial_ = serial;
+        return d;
+    }
+
+    constexpr int serial() const { return serial_; }
+    constexpr CivilDate civil() const { return civil_from_days(serial_); }
+    constexpr int year() const { return civil().year; }
+    constexpr unsigned month() const { return civil().month; }
+    constexpr unsigned day() const { return civil().day; }
+    // 0 = Sunday ... 6 = Saturday, as std::tm::tm_wday.
+    constexpr unsigned weekday() const {
+        return static_cast<unsigned>(serial_ >= -4 ? (serial_ + 4) % 7 : (serial_ + 5) % 7 + 6);
+    }
+    constexpr bool is_weekend() const {
+        const unsigned w = weekday();
+        return w == 0 || w == 6;
+    }
+
+    constexpr Date add_days(int n) const { return from_serial(serial_ + n); }
+    // Same day n months on, clamped to the end of a shorter month (Jan 31 + 1m = Feb 28/29).
+    constexpr Date add_months(int n) const {
+        const CivilDate c = civil();
+        const int total = c.year * 12 + static_cast<int>(c.month) - 1 + n;
+        const int y = total >= 0 ? total / 12 : (total - 11) / 12;
+        const auto m = static_cast<unsigned>(total - y * 12 + 1);
+        const unsigned dim = days_in_month(y, m);
+        return from_serial(days_from_civil(y, m, c.day < dim ? c.day : dim));
+    }
+    constexpr Date end_of_month() const {
+        const CivilDate c = civil();
+        return from_serial(serial_ + static_cast<int>(days_in_month(c.year, c.month) - c.day));
+    }
+    constexpr bool is_end_of_month() const { return day() == days_in_month(year(), month()); }
+
+    // Midnight UTC of this date.
     std::chrono::system_clock::time_point to_time_point() const;
 
     std::string to_string() const;
 
-    auto operator<=>(const Date&) const = default;
+    constexpr auto operator<=>(const Date&) const = default;
+    friend constexpr int operator-(const Date& a, const Date& b) { return a.serial_ - b.serial_; }
 
 private:
-    int year_{};
-    unsigned month_{};
-    unsigned day_{};
+    int serial_{0};
 };
 
 class DateTime {
@@ -51,21 +127,86 @@ private:
     std::chrono::system_clock::time_point tp_;
 };
 
+enum class BusinessDayConvention {
+    Unadjusted,
+    Following,         // next business day
+    ModifiedFollowing, // next business day unless that is in the next month, then the previous one
+    Preceding          // previous business day
+};
+
+// Business days over the years [first_year, last_year]: one bit per day (weekdays that are not
+// holidays), the business days before each 64-day word and the offset of every business day,
+// so is_business_day, business_days_between, advance_business_days and adjust are O(1) lookups.
+// Dates outside the range throw DataError; holidays outside it are ignored.
 class Calendar {
 public:
-    Calendar() = default;
-    explicit Calendar(std::set<Date> holidays) : holidays_(std::move(holidays)) {}
-
-    bool is_business_day(const Date& d) const;
-    Date adjust(const Date& d) const;
-    Date advance(const Date& d, int days) const;
-    void add_holiday(const Date& d) { holidays_.insert(d); }
+    static constexpr int default_first_year = 1970;
+    static constexpr int default_last_year = 2169;
+
+    Calendar() : Calendar(std::set<Date>{}) {}
+    explicit Calendar(const std::set<Date>& holidays, int first_year = default_first_year,
+                      int last_year = default_last_year);
+
+    // Holidays of either calendar (business day in both), or of both (business day in either).
+    enum class JointRule { Holidays, BusinessDays };
+    static Calendar joint(const Calendar& a, const Calendar& b, JointRule rule = JointRule::Holidays);
+
+    Date first() const { return Date::from_serial(first_); }
+    Date last() const { return Date::from_serial(first_ + static_cast<int>(days_) - 1); }
+
+    bool is_business_day(const Date& d) const {
+        const std::size_t i = offset(d, false);
+        return (bits_[i >> 6] >> (i & 63)) & 1u;
+    }
+    // Business days in [start, end); negative when end is before start.
+    long business_days_between(const Date& start, const Date& end) const {
+        return static_cast<long>(rank(end)) - static_cast<long>(rank(start));
+    }
+    // The n-th business day after d (before it for n < 0); d adjusted to the following business
+    // day for n = 0.
+    Date advance_business_days(const Date& d, long n) const;
+    Date adjust(const Date& d, BusinessDayConvention convention = BusinessDayConvention::Following) const;
+    // Calendar days.
+    Date advance(const Date& d, int days) const { return d.add_days(days); }
+    // Rebuilds the counts: O(days in range).
+    void add_holiday(const Date& d);
 
 private:
-    std::set<Date> holidays_;
+    std::size_t offset(const Date& d, bool allow_end) const {
+        const long i = static_cast<long>(d.serial()) - first_;
+        if (i < 0 || i > static_cast<long>(days_) - (allow_end ? 0 : 1)) {
+            throw DataError("Date " + d.to_string() + " outside the calendar range");
+        }
+        return static_cast<std::size_t>(i);
+    }
+    // Business days in [first(), d).
+    std::uint32_t rank(const Date& d) const {
+        const std::size_t i = offset(d, true), w = i >> 6;
+        const std::uint64_t below = (i & 63) ? bits_[w] & (~std::uint64_t{0} >> (64 - (i & 63))) : 0;
+        return words_before_[w] + static_cast<std::uint32_t>(std::popcount(below));
+    }
+    Date business_day(long index) const;
+    void count();
+
+    int first_{0};
+    std::size_t days_{0};
+    std::vector<std::uint64_t> bits_;          // days_ / 64 + 1 words, bits past the range clear
+    std::vector<std::uint32_t> words_before_;  // business days before each word
+    std::vector<std::uint32_t> business_;      // offset of the k-th business day
 };
 
-long day_count(const Date& start, const Date& end, DayCountConvention conv);
-double year_fraction(const Date& start, const Date& end, DayCountConvention conv);
+constexpr long day_count(const Date& start, const Date& end, DayCountConvention conv) {
+    if (conv == DayCountConvention::THIRTY_360) {
+        const CivilDate a = start.civil(), b = end.civil();
+        return 360L * (b.year - a.year) + 30L * (static_cast<long>(b.month) - static_cast<long>(a.month)) +
+               (static_cast<long>(b.day) - static_cast<long>(a.day));
+    }
+    return end - start;
+}
+
+constexpr double year_fraction(const Date& start, const Date& end, DayCountConvention conv) {
+    const auto days = static_cast<double>(day_count(start, end, conv));
+    return conv == DayCountConvention::ACT_365 ? days / 365.0 : days / 360.0;
+}
 
 } // namespace quant::core
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "quant/core/Math.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace quant::core {
+
+// Forward-mode dual number carrying N first-order derivatives in value type V: evaluating a
+// templated kernel once on Duals seeded with variable(x, k) gives d result / d x_k for every k.
+// Cheaper than a Tape when N is small and there are several outputs.
+template <std::size_t N, typename V = double>
+class Dual {
+public:
+    Dual(V value = V(0)) : value_(value), d_{} {}
+
+    // Independent variable number k of N.
+    static Dual variable(V value, std::size_t k) {
+        Dual x(value);
+        x.d_[k] = V(1);
+        return x;
+    }
+
+    V value() const { return value_; }
+    V derivative(std::size_t k) const { return d_[k]; }
+    const std::array<V, N>& derivatives() const { return d_; }
+
+    Dual& operator+=(const Dual& b) { return *this = *this + b; }
+    Dual& operator-=(const Dual& b) { return *this = *this - b; }
+    Dual& operator*=(const Dual& b) { return *this = *this * b; }
+    Dual& operator/=(const Dual& b) { return *this = *this / b; }
+
+    friend Dual operator+(const Dual& a, const Dual& b) { return chain(a.value_ + b.value_, a, V(1), b, V(1)); }
+    friend Dual operator-(const Dual& a, const Dual& b) { return chain(a.value_ - b.value_, a, V(1), b, V(-1)); }
+    friend Dual operator*(const Dual& a, const Dual& b) { return chain(a.value_ * b.value_, a, b.value_, b, a.value_); }
+    friend Dual operator/(const Dual& a, const Dual& b) {
+        V inv = V(1) / b.value_;
+        V q = a.value_ * inv;
+        return chain(q, a, inv, b, -q * inv);
+    }
+    friend Dual operator-(const Dual& a) { return chain(-a.value_, a, V(-1)); }
+    friend Dual operator+(const Dual& a) { return a; }
+
+    // Mixed operations skip the zero derivatives of a promoted constant.
+    friend Dual operator+(const Dual& a, V b) { return shift(a, a.value_ + b); }
+    friend Dual operator+(V a, const Dual& b) { return shift(b, a + b.value_); }
+    friend Dual operator-(const Dual& a, V b) { return shift(a, a.value_ - b); }
+    friend Dual operator-(V a, const Dual& b) { return chain(a - b.value_, b, V(-1)); }
+    friend Dual operator*(const Dual& a, V b) { return chain(a.value_ * b, a, b); }
+    friend Dual operator*(V a, const Dual& b) { return chain(a * b.value_, b, a); }
+    friend Dual operator/(const Dual& a, V b) { return chain(a.value_ / b, a, V(1) / b); }
+    friend Dual operator/(V a, const Dual& b) {
+        V inv = V(1) / b.value_;
+        return chain(a * inv, b, -a * inv * inv);
+    }
+
+    friend bool operator<(const Dual& a, const Dual& b) { return a.value_ < b.value_; }
+    friend bool operator<=(const Dual& a, const Dual& b) { return a.value_ <= b.value_; }
+    friend bool operator>(const Dual& a, const Dual& b) { return a.value_ > b.value_; }
+    friend bool operator>=(const Dual& a, const Dual& b) { return a.value_ >= b.value_; }
+    friend bool operator==(const Dual& a, const Dual& b) { return a.value_ == b.value_; }
+    friend bool operator!=(const Dual& a, const Dual& b) { return a.value_ != b.value_; }
+    friend bool operator<(const Dual& a, V b) { return a.value_ < b; }
+    friend bool operator<=(const Dual& a, V b) { return a.value_ <= b; }
+    friend bool operator>(const Dual& a, V b) { return a.value_ > b; }
+    friend bool operator>=(const Dual& a, V b) { return a.value_ >= b; }
+
+    friend Dual exp(const Dual& a) {
+        V e = std::exp(a.value_);
+        return chain(e, a, e);
+    }
+    friend Dual log(const Dual& a) { return chain(std::log(a.value_), a, V(1) / a.value_); }
+    friend Dual sqrt(const Dual& a) {
+        V s = std::sqrt(a.value_);
+        return chain(s, a, V(0.5) / s);
+    }
+    friend Dual abs(const Dual& a) { return chain(std::fabs(a.value_), a, a.value_ < V(0) ? V(-1) : V(1)); }
+    friend Dual fabs(const Dual& a) { return abs(a); }
+    friend Dual pow(const Dual& a, V p) {
+        V v = std::pow(a.value_, p);
+        return chain(v, a, p * std::pow(a.value_, p - V(1)));
+    }
+    friend Dual norm_cdf(const Dual& a) {
+        return chain(quant::core::norm_cdf(a.value_), a, quant::core::norm_pdf(a.value_));
+    }
+    friend Dual norm_pdf(const Dual& a) {
+        V p = quant::core::norm_pdf(a.value_);
+        return chain(p, a, -a.value_ * p);
+    }
+    friend V value_of(const Dual& a) { return a.value_; }
+
+private:
+    static Dual chain(V value, const Dual& a, V da) {
+        Dual r(value);
+        for (std::size_t k = 0; k < N; ++k) r.d_[k] = da * a.d_[k];
+        return r;
+    }
+    static Dual chain(V value, const Dual& a, V da, const Dual& b, V db) {
+        Dual r(value);
+        for (std::size_t k = 0; k < N; ++k) r.d_[k] = da * a.d_[k] + db * b.d_[k];
+        return r;
+    }
+    static Dual shift(const Dual& a, V value) {
+        Dual r = a;
+        r.value_ = value;
+        return r;
+    }
+
+    V value_;
+    std::array<V, N> d_;
+};
+
+template <std::size_t N, typename V>
+struct scalar_type<Dual<N, V>> {
+    using type = V;
+};
+
+} // namespace quant::core
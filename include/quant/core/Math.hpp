@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+namespace quant::core {
+
+inline constexpr double INV_SQRT_2PI = 0.39894228040143267794;
+inline constexpr double INV_SQRT_2 = 0.70710678118654752440;
+inline constexpr double SQRT_2PI = 2.50662827463100050242;
+
+inline double norm_cdf(double x) { return 0.5 * std::erfc(-x * INV_SQRT_2); }
+inline double norm_pdf(double x) { return std::exp(-0.5 * x * x) * INV_SQRT_2PI; }
+inline float norm_cdf(float x) { return 0.5f * std::erfc(-x * static_cast<float>(INV_SQRT_2)); }
+inline float norm_pdf(float x) { return std::exp(-0.5f * x * x) * static_cast<float>(INV_SQRT_2PI); }
+
+// Floating-point type underneath a scalar used by the templated kernels: the type itself for
+// float and double, the value type for AD numbers (core::Real, core::Dual). Kernels write their
+// constants in it so float instantiations stay in single precision.
+template <typename T>
+struct scalar_type {
+    using type = T;
+};
+template <typename T>
+using scalar_t = typename scalar_type<T>::type;
+
+inline float value_of(float x) { return x; }
+inline double value_of(double x) { return x; }
+
+// Inverse standard normal CDF: Acklam's rational approximation polished by one Halley step.
+inline double inverse_norm_cdf(double p) {
+    if (p <= 0.0) return -std::numeric_limits<double>::infinity();
+    if (p >= 1.0) return std::numeric_limits<double>::infinity();
+    static constexpr double a[6] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                                    1.383577518672690e+02, -3.066479806614716e+01, 2.506628277459239e+00};
+    static constexpr double b[5] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                                    6.680131188771972e+01, -1.328068155288572e+01};
+    static constexpr double c[6] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                                    -2.549732539343734e+00, 4.374664141464968e+00, 2.938163982698783e+00};
+    static constexpr double d[4] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                                    3.754408661907416e+00};
+    constexpr double p_low = 0.02425;
+    double x = 0.0;
+    if (p < p_low) {
+        double q = std::sqrt(-2.0 * std::log(p));
+        x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    } else if (p <= 1.0 - p_low) {
+        double q = p - 0.5;
+        double r = q * q;
+        x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+            (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+    } else {
+        double q = std::sqrt(-2.0 * std::log1p(-p));
+        x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+            ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+    }
+    // Halley refinement; the residual is taken in the tail that keeps full relative precision.
+    double e = x < 0.0 ? norm_cdf(x) - p : (1.0 - p) - norm_cdf(-x);
+    double u = e * SQRT_2PI * std::exp(0.5 * x * x);
+    return x - u / (1.0 + 0.5 * x * u);
+}
+
+} // namespace quant::core
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace quant::core {
+
+struct LevenbergMarquardtSettings {
+    std::size_t max_iterations{100};
+    double tolerance{1e-10}; // on the gradient, the step and the relative cost decrease
+    double initial_damping{1e-3};
+};
+
+struct LevenbergMarquardtResult {
+    double cost{0.0}; // 0.5 * sum of squared residuals at the solution
+    std::size_t iterations{0};
+    bool converged{false};
+};
+
+// Levenberg-Marquardt for a fixed number N of parameters with Marquardt diagonal scaling and
+// Nielsen's damping update. problem(x, r, J) must fill the m residuals r and, when J is not null,
+// the row-major m x N Jacobian. Residual buffers are allocated once per call.
+template <std::size_t N, typename Problem>
+LevenbergMarquardtResult levenberg_marquardt(Problem&& problem, std::array<double, N>& x, std::size_t m,
+                                             const LevenbergMarquardtSettings& settings = {}) {
+    using Mat = Eigen::Matrix<double, static_cast<int>(N), static_cast<int>(N)>;
+    using Vec = Eigen::Matrix<double, static_cast<int>(N), 1>;
+    std::vector<double> r(m), J(m * N), r_try(m), J_try(m * N);
+    auto half_norm = [](const std::vector<double>& v) {
+        double s = 0.0;
+        for (double e : v) s += e * e;
+        return 0.5 * s;
+    };
+
+    LevenbergMarquardtResult res;
+    problem(x, r.data(), J.data());
+    res.cost = half_norm(r);
+    double mu = -1.0, growth = 2.0;
+    for (; res.iterations < settings.max_iterations; ++res.iterations) {
+        Mat A = Mat::Zero();
+        Vec g = Vec::Zero();
+        for (std::size_t i = 0; i < m; ++i) {
+            Eigen::Map<const Vec> row(&J[i * N]);
+            A.noalias() += row * row.transpose();
+            g.noalias() += row * r[i];
+        }
+        if (g.cwiseAbs().maxCoeff() <= settings.tolerance) {
+            res.converged = true;
+            break;
+        }
+        Vec scale = A.diagonal().cwiseMax(1e-12);
+        if (mu < 0.0) mu = settings.initial_damping * scale.maxCoeff();
+        Mat damped = A;
+        damped.diagonal() += mu * scale;
+        Vec step = damped.ldlt().solve(-g);
+
+        std::array<double, N> trial;
+        double step_norm = 0.0, x_norm = 0.0;
+        for (std::size_t k = 0; k < N; ++k) {
+            trial[k] = x[k] + step[static_cast<int>(k)];
+            step_norm += step[static_cast<int>(k)] * step[static_cast<int>(k)];
+            x_norm += x[k] * x[k];
+        }
+        if (std::sqrt(step_norm) <= settings.tolerance * (std::sqrt(x_norm) + settings.tolerance)) {
+            res.converged = true;
+            break;
+        }
+        problem(trial, r_try.data(), J_try.data());
+        double cost = half_norm(r_try);
+        // Ratio of actual to predicted decrease; the prediction is 0.5 step' (mu D step - g).
+        double predicted = 0.5 * step.dot(mu * scale.cwiseProduct(step) - g);
+        double rho = std::isfinite(cost) && predicted > 0.0 ? (res.cost - cost) / predicted : -1.0;
+        if (rho > 0.0) {
+            double previous = res.cost;
+            x = trial;
+            r.swap(r_try);
+            J.swap(J_try);
+            res.cost = cost;
+            mu *= std::max(1.0 / 3.0, 1.0 - std::pow(2.0 * rho - 1.0, 3));
+            growth = 2.0;
+            if (previous - cost <= settings.tolerance * std::max(previous, settings.tolerance)) {
+                res.converged = true;
+                ++res.iterations;
+                break;
+            }
+        } else {
+            mu *= growth;
+            growth *= 2.0;
+        }
+    }
+    return res;
+}
+
+} // namespace quant::core
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace quant::core {
+
+inline std::size_t hardware_threads() {
+    unsigned n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : static_cast<std::size_t>(n);
+}
+
+// Splits [0, n) into at most `threads` contiguous ranges of at least `min_block` items and
+// calls fn(begin, end) on each, the first range on the calling thread. threads == 0 uses
+// every hardware thread. The first exception thrown by any range is rethrown after joining.
+template <typename Fn>
+void parallel_for(std::size_t n, std::size_t threads, std::size_t min_block, Fn&& fn) {
+    if (n == 0) return;
+    if (threads == 0) threads = hardware_threads();
+    min_block = std::max<std::size_t>(min_block, 1);
+    std::size_t blocks = std::min(threads, (n + min_block - 1) / min_block);
+    if (blocks <= 1) {
+        fn(std::size_t{0}, n);
+        return;
+    }
+    std::size_t chunk = (n + blocks - 1) / blocks;
+    std::vector<std::exception_ptr> errors(blocks);
+    std::vector<std::thread> workers;
+    workers.reserve(blocks - 1);
+    for (std::size_t b = 1; b < blocks; ++b) {
+        std::size_t begin = b * chunk;
+        std::size_t end = std::min(n, begin + chunk);
+        if (begin >= end) break;
+        workers.emplace_back([&fn, &errors, b, begin, end]() {
+            try {
+                fn(begin, end);
+            } catch (...) {
+                errors[b] = std::current_exception();
+            }
+        });
+    }
+    try {
+        fn(std::size_t{0}, std::min(n, chunk));
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+    for (auto& w : workers) w.join();
+    for (auto& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+}
+
+} // namespace quant::core
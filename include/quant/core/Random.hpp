@@ -0,0 +1,57 @@
+#pragma once
+
+#include "quant/core/Math.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace quant::core {
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3").
+// Output is a pure function of (counter, key), so any stream position can be generated on any
+// thread without sharing state.
+class Philox4x32 {
+public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    static Counter generate(Counter ctr, Key key) {
+        for (int round = 0; round < 10; ++round) {
+            if (round > 0) {
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * ctr[0];
+            std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * ctr[2];
+            ctr = {static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<std::uint32_t>(p1),
+                   static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<std::uint32_t>(p0)};
+        }
+        return ctr;
+    }
+};
+
+// Uniform in (0, 1) from 64 random bits, never returning 0 or 1.
+inline double to_open_unit(std::uint64_t bits) {
+    return (static_cast<double>(bits >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+// Addressable stream of standard normals: draw(stream, index) depends only on the seed and its arguments.
+class PhiloxNormals {
+public:
+    explicit PhiloxNormals(std::uint64_t seed)
+        : key_{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)} {}
+
+    // Normals number 2 * pair and 2 * pair + 1 of the given stream.
+    std::array<double, 2> pair(std::uint64_t stream, std::uint32_t pair) const {
+        Philox4x32::Counter ctr{pair, 0u, static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)};
+        auto r = Philox4x32::generate(ctr, key_);
+        std::uint64_t a = (static_cast<std::uint64_t>(r[0]) << 32) | r[1];
+        std::uint64_t b = (static_cast<std::uint64_t>(r[2]) << 32) | r[3];
+        return {inverse_norm_cdf(to_open_unit(a)), inverse_norm_cdf(to_open_unit(b))};
+    }
+
+private:
+    Philox4x32::Key key_;
+};
+
+} // namespace quant::core
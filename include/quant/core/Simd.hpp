@@ -0,0 +1,214 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Minimal fixed-width double vector used by the batched pricing kernels.
+// The lane count is picked at compile time (AVX-512 -> 8, AVX2 -> 4, otherwise 1);
+// every backend runs the same polynomial approximations so results do not depend
+// on the instruction set beyond last-bit rounding of fused operations.
+namespace quant::core::simd {
+
+#if defined(__AVX512F__)
+
+inline constexpr std::size_t width = 8;
+struct Vec { __m512d v; };
+struct Mask { __mmask8 m; };
+
+inline Vec broadcast(double x) { return {_mm512_set1_pd(x)}; }
+inline Vec load(const double* p) { return {_mm512_loadu_pd(p)}; }
+inline void store(double* p, Vec a) { _mm512_storeu_pd(p, a.v); }
+inline Vec operator+(Vec a, Vec b) { return {_mm512_add_pd(a.v, b.v)}; }
+inline Vec operator-(Vec a, Vec b) { return {_mm512_sub_pd(a.v, b.v)}; }
+inline Vec operator*(Vec a, Vec b) { return {_mm512_mul_pd(a.v, b.v)}; }
+inline Vec operator/(Vec a, Vec b) { return {_mm512_div_pd(a.v, b.v)}; }
+inline Vec fma(Vec a, Vec b, Vec c) { return {_mm512_fmadd_pd(a.v, b.v, c.v)}; }
+inline Vec sqrt(Vec a) { return {_mm512_sqrt_pd(a.v)}; }
+inline Vec abs(Vec a) { return {_mm512_abs_pd(a.v)}; }
+inline Vec min(Vec a, Vec b) { return {_mm512_min_pd(a.v, b.v)}; }
+inline Vec max(Vec a, Vec b) { return {_mm512_max_pd(a.v, b.v)}; }
+inline Vec round(Vec a) { return {_mm512_roundscale_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)}; }
+inline Mask operator<(Vec a, Vec b) { return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ)}; }
+inline Mask operator>(Vec a, Vec b) { return {_mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ)}; }
+inline Mask operator&(Mask a, Mask b) { return {static_cast<__mmask8>(a.m & b.m)}; }
+inline Mask operator|(Mask a, Mask b) { return {static_cast<__mmask8>(a.m | b.m)}; }
+inline Vec select(Mask m, Vec a, Vec b) { return {_mm512_mask_blend_pd(m.m, b.v, a.v)}; }
+// x * 2^n for integral-valued n.
+inline Vec ldexp(Vec x, Vec n) { return {_mm512_scalef_pd(x.v, n.v)}; }
+// Splits a positive normal x into mantissa in [1, 2) and unbiased exponent.
+inline Vec split_exponent(Vec x, Vec& mantissa) {
+    mantissa = {_mm512_getmant_pd(x.v, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_zero)};
+    return {_mm512_getexp_pd(x.v)};
+}
+
+#elif defined(__AVX2__)
+
+inline constexpr std::size_t width = 4;
+struct Vec { __m256d v; };
+struct Mask { __m256d m; };
+
+inline Vec broadcast(double x) { return {_mm256_set1_pd(x)}; }
+inline Vec load(const double* p) { return {_mm256_loadu_pd(p)}; }
+inline void store(double* p, Vec a) { _mm256_storeu_pd(p, a.v); }
+inline Vec operator+(Vec a, Vec b) { return {_mm256_add_pd(a.v, b.v)}; }
+inline Vec operator-(Vec a, Vec b) { return {_mm256_sub_pd(a.v, b.v)}; }
+inline Vec operator*(Vec a, Vec b) { return {_mm256_mul_pd(a.v, b.v)}; }
+inline Vec operator/(Vec a, Vec b) { return {_mm256_div_pd(a.v, b.v)}; }
+#if defined(__FMA__)
+inline Vec fma(Vec a, Vec b, Vec c) { return {_mm256_fmadd_pd(a.v, b.v, c.v)}; }
+#else
+inline Vec fma(Vec a, Vec b, Vec c) { return a * b + c; }
+#endif
+inline Vec sqrt(Vec a) { return {_mm256_sqrt_pd(a.v)}; }
+inline Vec abs(Vec a) { return {_mm256_andnot_pd(_mm256_set1_pd(-0.0), a.v)}; }
+inline Vec min(Vec a, Vec b) { return {_mm256_min_pd(a.v, b.v)}; }
+inline Vec max(Vec a, Vec b) { return {_mm256_max_pd(a.v, b.v)}; }
+inline Vec round(Vec a) { return {_mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)}; }
+inline Mask operator<(Vec a, Vec b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)}; }
+inline Mask operator>(Vec a, Vec b) { return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)}; }
+inline Mask operator&(Mask a, Mask b) { return {_mm256_and_pd(a.m, b.m)}; }
+inline Mask operator|(Mask a, Mask b) { return {_mm256_or_pd(a.m, b.m)}; }
+inline Vec select(Mask m, Vec a, Vec b) { return {_mm256_blendv_pd(b.v, a.v, m.m)}; }
+inline Vec ldexp(Vec x, Vec n) {
+    // (k + 1023) lands in the low mantissa bits after adding 2^52; shift it into the exponent field.
+    auto pow2 = [](__m256d k) {
+        __m256d biased = _mm256_add_pd(k, _mm256_set1_pd(4503599627370496.0 + 1023.0));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(biased), 52));
+    };
+    // Two factors, so n = 1024 (exp just below its overflow) stays finite: 2^1024 has no encoding.
+    __m256d half = _mm256_floor_pd(_mm256_mul_pd(n.v, _mm256_set1_pd(0.5)));
+    return {_mm256_mul_pd(_mm256_mul_pd(x.v, pow2(half)), pow2(_mm256_sub_pd(n.v, half)))};
+}
+inline Vec split_exponent(Vec x, Vec& mantissa) {
+    __m256i bits = _mm256_castpd_si256(x.v);
+    __m256i mant = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+                                   _mm256_set1_epi64x(0x3FF0000000000000LL));
+    mantissa = {_mm256_castsi256_pd(mant)};
+    __m256i e = _mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(0x4330000000000000LL));
+    return {_mm256_sub_pd(_mm256_castsi256_pd(e), _mm256_set1_pd(4503599627370496.0 + 1023.0))};
+}
+
+#else
+
+inline constexpr std::size_t width = 1;
+struct Vec { double v; };
+struct Mask { bool m; };
+
+inline Vec broadcast(double x) { return {x}; }
+inline Vec load(const double* p) { return {*p}; }
+inline void store(double* p, Vec a) { *p = a.v; }
+inline Vec operator+(Vec a, Vec b) { return {a.v + b.v}; }
+inline Vec operator-(Vec a, Vec b) { return {a.v - b.v}; }
+inline Vec operator*(Vec a, Vec b) { return {a.v * b.v}; }
+inline Vec operator/(Vec a, Vec b) { return {a.v / b.v}; }
+inline Vec fma(Vec a, Vec b, Vec c) { return {a.v * b.v + c.v}; }
+inline Vec sqrt(Vec a) { return {std::sqrt(a.v)}; }
+inline Vec abs(Vec a) { return {std::fabs(a.v)}; }
+inline Vec min(Vec a, Vec b) { return {a.v < b.v ? a.v : b.v}; }
+inline Vec max(Vec a, Vec b) { return {a.v > b.v ? a.v : b.v}; }
+inline Vec round(Vec a) { return {std::nearbyint(a.v)}; }
+inline Mask operator<(Vec a, Vec b) { return {a.v < b.v}; }
+inline Mask operator>(Vec a, Vec b) { return {a.v > b.v}; }
+inline Mask operator&(Mask a, Mask b) { return {a.m && b.m}; }
+inline Mask operator|(Mask a, Mask b) { return {a.m || b.m}; }
+inline Vec select(Mask m, Vec a, Vec b) { return m.m ? a : b; }
+inline Vec ldexp(Vec x, Vec n) { return {std::ldexp(x.v, static_cast<int>(n.v))}; }
+inline Vec split_exponent(Vec x, Vec& mantissa) {
+    int e = 0;
+    mantissa = {2.0 * std::frexp(x.v, &e)};
+    return {static_cast<double>(e - 1)};
+}
+
+#endif
+
+inline Vec operator-(Vec a) { return broadcast(0.0) - a; }
+
+// exp(x); underflows to 0 below -708.39 and overflows to +inf above 709.78.
+inline Vec exp(Vec x) {
+    const Vec lo = broadcast(-708.39641853226408);
+    const Vec hi = broadcast(709.78271289338397);
+    Vec xc = min(max(x, lo), hi);
+    Vec n = round(xc * broadcast(1.4426950408889634074));
+    Vec r = fma(n, broadcast(-0.693145751953125), xc);
+    r = fma(n, broadcast(-1.42860682030941723212e-6), r);
+    // Taylor series to degree 13 on |r| <= ln(2)/2.
+    Vec p = broadcast(1.0 / 6227020800.0);
+    p = fma(p, r, broadcast(1.0 / 479001600.0));
+    p = fma(p, r, broadcast(1.0 / 39916800.0));
+    p = fma(p, r, broadcast(1.0 / 3628800.0));
+    p = fma(p, r, broadcast(1.0 / 362880.0));
+    p = fma(p, r, broadcast(1.0 / 40320.0));
+    p = fma(p, r, broadcast(1.0 / 5040.0));
+    p = fma(p, r, broadcast(1.0 / 720.0));
+    p = fma(p, r, broadcast(1.0 / 120.0));
+    p = fma(p, r, broadcast(1.0 / 24.0));
+    p = fma(p, r, broadcast(1.0 / 6.0));
+    p = fma(p, r, broadcast(0.5));
+    p = fma(p, r, broadcast(1.0));
+    p = fma(p, r, broadcast(1.0));
+    Vec out = ldexp(p, n);
+    out = select(x < lo, broadcast(0.0), out);
+    return select(x > hi, broadcast(HUGE_VAL), out);
+}
+
+// Natural log for positive normal inputs.
+inline Vec log(Vec x) {
+    Vec m;
+    Vec e = split_exponent(x, m);
+    Mask big = m > broadcast(1.4142135623730950488);
+    m = select(big, m * broadcast(0.5), m);
+    e = select(big, e + broadcast(1.0), e);
+    Vec f = (m - broadcast(1.0)) / (m + broadcast(1.0));
+    Vec s = f * f;
+    // 2 atanh(f) = 2 f (1 + s/3 + s^2/5 + ...), |f| <= 0.1716.
+    Vec p = broadcast(1.0 / 23.0);
+    p = fma(p, s, broadcast(1.0 / 21.0));
+    p = fma(p, s, broadcast(1.0 / 19.0));
+    p = fma(p, s, broadcast(1.0 / 17.0));
+    p = fma(p, s, broadcast(1.0 / 15.0));
+    p = fma(p, s, broadcast(1.0 / 13.0));
+    p = fma(p, s, broadcast(1.0 / 11.0));
+    p = fma(p, s, broadcast(1.0 / 9.0));
+    p = fma(p, s, broadcast(1.0 / 7.0));
+    p = fma(p, s, broadcast(1.0 / 5.0));
+    p = fma(p, s, broadcast(1.0 / 3.0));
+    p = fma(p, s, broadcast(1.0));
+    Vec lm = broadcast(2.0) * f * p;
+    return fma(e, broadcast(0.69314718055994530942), lm);
+}
+
+// Standard normal CDF via the Chebyshev erfc expansion (Numerical Recipes 3rd ed., ~1.2e-16 relative).
+inline Vec norm_cdf(Vec x) {
+    static constexpr double cof[28] = {
+        -1.3026537197817094, 6.4196979235649026e-1, 1.9476473204185836e-2, -9.561514786808631e-3,
+        -9.46595344482036e-4, 3.66839497852761e-4, 4.2523324806907e-5, -2.0278578112534e-5,
+        -1.624290004647e-6, 1.303655835580e-6, 1.5626441722e-8, -8.5238095915e-8,
+        6.529054439e-9, 5.059343495e-9, -9.91364156e-10, -2.27365122e-10,
+        9.6467911e-11, 2.394038e-12, -6.886027e-12, 8.94487e-13,
+        3.13092e-13, -1.12708e-13, 3.81e-16, 7.106e-15,
+        -1.523e-15, -9.4e-17, 1.21e-16, -2.8e-17};
+    Vec z = abs(x) * broadcast(0.70710678118654752440);
+    Vec t = broadcast(2.0) / (broadcast(2.0) + z);
+    Vec ty = fma(broadcast(4.0), t, broadcast(-2.0));
+    Vec d = broadcast(0.0);
+    Vec dd = broadcast(0.0);
+    for (int j = 27; j > 0; --j) {
+        Vec tmp = d;
+        d = fma(ty, d, broadcast(cof[j]) - dd);
+        dd = tmp;
+    }
+    Vec erfc_z = t * exp(fma(-z, z, broadcast(0.5) * fma(ty, d, broadcast(cof[0]))) - dd);
+    Vec half = broadcast(0.5) * erfc_z;
+    return select(x < broadcast(0.0), half, broadcast(1.0) - half);
+}
+
+inline Vec norm_pdf(Vec x) {
+    return exp(broadcast(-0.5) * x * x) * broadcast(0.39894228040143267794);
+}
+
+} // namespace quant::core::simd
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace quant::core {
+
+// Sobol low-discrepancy sequence with Joe-Kuo (new-joe-kuo-6.21201) direction numbers.
+// Scrambling applies a random linear (lower-triangular) digital scramble plus a digital shift
+// per dimension, keyed by seed; any point can be reached directly, so independent blocks can
+// be generated on different threads.
+class SobolSequence {
+public:
+    static constexpr std::size_t kBits = 32;
+
+    SobolSequence(std::size_t dimension, bool scramble = true, std::uint64_t seed = 0);
+
+    static std::size_t max_dimension();
+    std::size_t dimension() const { return dimension_; }
+
+    // Sequential generator positioned at an arbitrary index (Gray-code order).
+    class Cursor {
+    public:
+        // Writes dimension() uniforms in (0, 1) and advances by one point.
+        void next(double* out);
+        std::uint64_t index() const { return index_; }
+
+    private:
+        friend class SobolSequence;
+        Cursor(const SobolSequence& seq, std::uint64_t index);
+
+        const SobolSequence* seq_;
+        std::vector<std::uint32_t> state_;
+        std::uint64_t index_;
+    };
+
+    Cursor cursor(std::uint64_t start = 0) const { return Cursor(*this, start); }
+
+private:
+    std::size_t dimension_;
+    std::vector<std::uint32_t> directions_; // dimension_ x kBits, row-major
+    std::vector<std::uint32_t> shift_;
+};
+
+} // namespace quant::core
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "quant/core/Simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace quant::core {
+
+// Thomas algorithm for one tridiagonal matrix and many right-hand sides. The elimination is
+// factored once; solve() runs the substitution sweeps over interleaved systems stored as
+// rhs[i * lanes + l], vectorised across lanes. Buffers are reused when the size does not change.
+// With a floor the back substitution is projected (Brennan-Schwartz), which solves the linear
+// complementarity problem exactly when the constrained rows form a block at the end of the system.
+class TridiagonalSolver {
+public:
+    // Row i is lower[i] x[i - 1] + diag[i] x[i] + upper[i] x[i + 1]; lower[0] and upper[n - 1] are ignored.
+    void factor(const double* lower, const double* diag, const double* upper, std::size_t n) {
+        lower_.assign(lower, lower + n);
+        upper_.resize(n);
+        inv_.resize(n);
+        double prev = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            inv_[i] = 1.0 / (diag[i] - (i > 0 ? lower[i] * prev : 0.0));
+            prev = upper_[i] = i + 1 < n ? upper[i] * inv_[i] : 0.0;
+        }
+    }
+
+    std::size_t size() const { return inv_.size(); }
+
+    // Solves in place for all lanes; with floor (same layout as rhs) the solution is kept above it.
+    void solve(double* rhs, std::size_t lanes, const double* floor = nullptr) const {
+        std::size_t l = 0;
+        for (; l + simd::width <= lanes; l += simd::width) {
+            floor ? sweep<true>(rhs + l, floor + l, lanes) : sweep<false>(rhs + l, nullptr, lanes);
+        }
+        for (; l < lanes; ++l) {
+            floor ? sweep_scalar<true>(rhs + l, floor + l, lanes) : sweep_scalar<false>(rhs + l, nullptr, lanes);
+        }
+    }
+
+private:
+    template <bool Floor>
+    void sweep(double* x, const double* g, std::size_t stride) const {
+        using namespace simd;
+        const std::size_t n = inv_.size();
+        Vec prev = load(x) * broadcast(inv_[0]);
+        store(x, prev);
+        for (std::size_t i = 1; i < n; ++i) {
+            double* row = x + i * stride;
+            prev = (load(row) - broadcast(lower_[i]) * prev) * broadcast(inv_[i]);
+            store(row, prev);
+        }
+        if constexpr (Floor) {
+            prev = max(prev, load(g + (n - 1) * stride));
+            store(x + (n - 1) * stride, prev);
+        }
+        for (std::size_t i = n - 1; i-- > 0;) {
+            double* row = x + i * stride;
+            prev = load(row) - broadcast(upper_[i]) * prev;
+            if constexpr (Floor) prev = max(prev, load(g + i * stride));
+            store(row, prev);
+        }
+    }
+
+    template <bool Floor>
+    void sweep_scalar(double* x, const double* g, std::size_t stride) const {
+        const std::size_t n = inv_.size();
+        x[0] *= inv_[0];
+        for (std::size_t i = 1; i < n; ++i) x[i * stride] = (x[i * stride] - lower_[i] * x[(i - 1) * stride]) * inv_[i];
+        if constexpr (Floor) x[(n - 1) * stride] = std::max(x[(n - 1) * stride], g[(n - 1) * stride]);
+        for (std::size_t i = n - 1; i-- > 0;) {
+            x[i * stride] -= upper_[i] * x[(i + 1) * stride];
+            if constexpr (Floor) x[i * stride] = std::max(x[i * stride], g[i * stride]);
+        }
+    }
+
+    std::vector<double> lower_;
+    std::vector<double> upper_; // upper[i] / pivot[i]
+    std::vector<double> inv_;   // 1 / pivot[i]
+};
+
+} // namespace quant::core
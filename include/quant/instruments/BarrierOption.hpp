@@ -22,7 +22,7 @@ public:
     double barrier() const { return barrier_; }
     double rebate() const { return rebate_; }
 
-    double npv() const override; // priced via internal closed-form for vanilla fallback
+    double npv() const override; // continuously monitored closed form
 
 private:
     BarrierType barrier_type_;
@@ -2,12 +2,11 @@
 
 #include "quant/core/Date.hpp"
 #include "quant/instruments/Instrument.hpp"
+#include "quant/market/Fwd.hpp"
 
 #include <optional>
 #include <string>
 
-namespace quant::market { class YieldCurve; class VolSurface; }
-
 namespace quant::instruments {
 
 enum class OptionType { Call, Put };
@@ -28,6 +27,8 @@ public:
 
     void set_vol_surface(const market::VolSurface* surface) { vol_surface_ = surface; }
     void set_yield_curve(const market::YieldCurve* curve) { curve_ = curve; }
+    const market::VolSurface* vol_surface() const { return vol_surface_; }
+    const market::YieldCurve* yield_curve() const { return curve_; }
 
     double npv() const override;
 
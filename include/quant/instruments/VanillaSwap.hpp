@@ -2,22 +2,43 @@
 
 #include "quant/core/Date.hpp"
 #include "quant/core/Exceptions.hpp"
+#include "quant/core/Math.hpp"
+#include "quant/core/Simd.hpp"
 #include "quant/instruments/Instrument.hpp"
+#include "quant/market/Fwd.hpp"
+#include "quant/market/Views.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <type_traits>
 #include <vector>
 
-namespace quant::market { class YieldCurve; }
-
 namespace quant::instruments {
 
 enum class SwapType { Payer, Receiver };
 
 enum class Frequency { Annual = 1, SemiAnnual = 2, Quarterly = 4 };
 
+// Dates are start + k periods (clamped to month end) up to end, which closes a short last period.
+// With a calendar every date, start and end included, then moves to a business day under
+// convention. A swap reads the calendar only while it is constructed.
 struct Schedule {
     quant::core::Date start;
     quant::core::Date end;
     Frequency frequency{Frequency::Annual};
+    const quant::core::Calendar* calendar{nullptr};
+    quant::core::BusinessDayConvention convention{quant::core::BusinessDayConvention::ModifiedFollowing};
+};
+
+// The curve-independent part of a swap, compiled once at construction. Fixed period i pays
+// fixed_accrual[i] at fixed_time[i]; float period i accrues over the fixing interval
+// [float_time[i], float_time[i + 1]] and pays at its end. Times are year fractions from each
+// leg's schedule start under the leg's day count.
+struct SwapCashflows {
+    std::vector<double> fixed_accrual;
+    std::vector<double> fixed_time;
+    std::vector<double> float_time; // float periods + 1 boundaries
 };
 
 class VanillaSwap : public Instrument {
@@ -33,7 +54,21 @@ public:
                 double float_spread = 0.0);
 
     double npv() const override;
+    // Value on any curve or curve view; on a BasicYieldCurve<core::Real> the valuation is recorded
+    // for pillar sensitivities.
+    template <market::DiscountCurve Curve>
+    auto npv(const Curve& curve) const;
     double fair_rate() const;
+    template <market::DiscountCurve Curve>
+    auto fair_rate(const Curve& curve) const;
+    // Fixed-leg annuity per unit notional: sum of accrual x discount factor.
+    double annuity() const;
+    template <market::DiscountCurve Curve>
+    auto annuity(const Curve& curve) const;
+    const SwapCashflows& cashflows() const { return cashflows_; }
+    // Period end dates of each leg, preceded by the schedule start, business-day adjusted.
+    const std::vector<quant::core::Date>& fixed_dates() const { return fixed_dates_; }
+    const std::vector<quant::core::Date>& float_dates() const { return float_dates_; }
 
     const market::YieldCurve* discount_curve() const { return discount_curve_; }
     double notional() const { return notional_; }
@@ -46,6 +81,14 @@ public:
     double float_spread() const { return float_spread_; }
 
 private:
+    // Per unit notional: fixed annuity, float leg at the forwards, float annuity.
+    template <typename T>
+    struct Legs {
+        T annuity, float_leg, float_annuity;
+    };
+    template <market::DiscountCurve Curve>
+    auto legs(const Curve& curve) const;
+
     std::vector<quant::core::Date> build_dates(const Schedule& schedule) const;
 
     SwapType type_;
@@ -57,6 +100,98 @@ private:
     quant::core::DayCountConvention float_dcc_;
     const market::YieldCurve* discount_curve_;
     double float_spread_;
+    std::vector<quant::core::Date> fixed_dates_;
+    std::vector<quant::core::Date> float_dates_;
+    SwapCashflows cashflows_;
 };
 
+template <market::DiscountCurve Curve>
+auto VanillaSwap::legs(const Curve& curve) const {
+    using T = decltype(curve.discount(0.0));
+    using Scalar = quant::core::scalar_t<T>;
+    const SwapCashflows& cf = cashflows_;
+    Legs<T> legs{T(Scalar(0)), T(Scalar(0)), T(Scalar(0))};
+    if constexpr (std::is_same_v<T, double> &&
+                  requires(std::span<const double> t, std::span<double> out) { curve.zero_rate(t, out); }) {
+        // Zero rates in hinted batches give y = z t = -ln P at every payment time, exponentiated
+        // together (vectorised in SIMD builds); a float period's forward x accrual is the
+        // difference of y over its fixing interval.
+        namespace simd = quant::core::simd;
+        constexpr std::size_t chunk = 64;
+        double y[chunk], df[chunk] = {};
+        auto discount = [&](std::span<const double> t) {
+            curve.zero_rate(t, std::span<double>(y, t.size()));
+            for (std::size_t i = 0; i < t.size(); ++i) {
+                y[i] *= t[i];
+                df[i] = -y[i];
+            }
+            if constexpr (simd::width > 1) {
+                for (std::size_t i = 0; i < t.size(); i += simd::width) simd::store(df + i, simd::exp(simd::load(df + i)));
+            } else {
+                for (std::size_t i = 0; i < t.size(); ++i) df[i] = std::exp(df[i]);
+            }
+        };
+        const std::span<const double> fixed_time(cf.fixed_time), float_time(cf.float_time);
+        for (std::size_t b = 0; b < fixed_time.size(); b += chunk) {
+            auto t = fixed_time.subspan(b, std::min(chunk, fixed_time.size() - b));
+            discount(t);
+            for (std::size_t i = 0; i < t.size(); ++i) legs.annuity += cf.fixed_accrual[b + i] * df[i];
+        }
+        double y_prev = 0.0;
+        for (std::size_t b = 0; b < float_time.size(); b += chunk) {
+            auto t = float_time.subspan(b, std::min(chunk, float_time.size() - b));
+            discount(t);
+            for (std::size_t i = 0; i < t.size(); ++i) {
+                if (b + i > 0) {
+                    legs.float_leg += (y[i] - y_prev) * df[i];
+                    legs.float_annuity += (t[i] - float_time[b + i - 1]) * df[i];
+                }
+                y_prev = y[i];
+            }
+        }
+        return legs;
+    }
+    for (std::size_t i = 0; i < cf.fixed_time.size(); ++i) {
+        legs.annuity += Scalar(cf.fixed_accrual[i]) * curve.discount(cf.fixed_time[i]);
+    }
+    for (std::size_t i = 1; i < cf.float_time.size(); ++i) {
+        const double t1 = cf.float_time[i - 1], t2 = cf.float_time[i];
+        T weighted_df = Scalar(t2 - t1) * curve.discount(t2);
+        legs.float_leg += curve.forward_rate(t1, t2) * weighted_df;
+        legs.float_annuity += weighted_df;
+    }
+    return legs;
+}
+
+template <market::DiscountCurve Curve>
+auto VanillaSwap::npv(const Curve& curve) const {
+    using T = decltype(curve.discount(0.0));
+    using Scalar = quant::core::scalar_t<T>;
+    auto l = legs(curve);
+    T fixed_leg = Scalar(notional_ * fixed_rate_) * l.annuity;
+    T float_leg = Scalar(notional_) * (l.float_leg + Scalar(float_spread_) * l.float_annuity);
+    const Scalar sign = (type_ == SwapType::Payer) ? Scalar(1) : Scalar(-1);
+    return T(sign * (fixed_leg - float_leg));
+}
+
+template <market::DiscountCurve Curve>
+auto VanillaSwap::fair_rate(const Curve& curve) const {
+    using T = decltype(curve.discount(0.0));
+    using Scalar = quant::core::scalar_t<T>;
+    auto l = legs(curve);
+    if (l.annuity == Scalar(0)) throw quant::core::QuantError("Zero annuity in fair rate computation");
+    return T(l.float_leg / l.annuity - Scalar(float_spread_));
+}
+
+template <market::DiscountCurve Curve>
+auto VanillaSwap::annuity(const Curve& curve) const {
+    using T = decltype(curve.discount(0.0));
+    using Scalar = quant::core::scalar_t<T>;
+    T annuity(Scalar(0));
+    for (std::size_t i = 0; i < cashflows_.fixed_time.size(); ++i) {
+        annuity += Scalar(cashflows_.fixed_accrual[i]) * curve.discount(cashflows_.fixed_time[i]);
+    }
+    return annuity;
+}
+
 } // namespace quant::instruments
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/YieldCurve.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace quant::market {
+
+struct BootstrapSettings {
+    double accuracy{1e-12}; // on each pillar zero rate
+    std::size_t max_iterations{50};
+};
+
+// Builds a YieldCurve whose pillars sit at the last payment time of each quoted instrument:
+// deposits (simple rate from 0 to maturity), FRAs (simple forward rate between two times) and
+// swaps at par, valued as VanillaSwap::npv values them, with times from their own start date.
+// Pillars are solved in time order by Newton's method, falling back to bisection. Quotes can be
+// changed afterwards; curve() then re-solves only from the earliest pillar whose quote changed,
+// and of every later instrument re-values only the cashflows on segments that moved. Pillar
+// values depend on later pillars under monotone convex interpolation, which is not supported.
+class CurveBootstrapper {
+public:
+    explicit CurveBootstrapper(CurveInterpolation interpolation = CurveInterpolation::LinearZero,
+                               BootstrapSettings settings = {});
+
+    // Each returns the quote index of the new instrument.
+    std::size_t add_deposit(double maturity, double rate);
+    std::size_t add_fra(double start, double end, double rate);
+    std::size_t add_swap(const quant::instruments::VanillaSwap& swap); // quoted by its fixed rate
+
+    void set_quote(std::size_t index, double quote);
+    double quote(std::size_t index) const { return helpers_.at(index).quote; }
+    std::size_t size() const { return helpers_.size(); }
+
+    const YieldCurve& curve();
+
+private:
+    enum class TermKind : std::uint8_t { Fixed, Float, Log };
+    // Time t on pillar segment m: -ln P(t) = alpha q[m - 1] + beta q[m], q the pillar zero rates.
+    struct Node {
+        double time;
+        double alpha;
+        double beta;
+        std::uint32_t segment;
+    };
+    // Fixed: -quote c P(t2); Float: (-ln P(t2) + ln P(t1) + c) P(t2); Log: -ln P(t2) + ln P(t1).
+    struct Term {
+        TermKind kind;
+        std::uint32_t n1;
+        std::uint32_t n2;
+        double c;
+    };
+    // Residual: sum of terms, with Fixed terms scaled by the quote, minus ln(1 + quote tau) when
+    // tau > 0. Terms are ordered by the segment of their payment node; cumulative sums of the
+    // quote-free and quote-scaled parts are cached per segment and gathered from the values of
+    // the shared terms, which instruments on a common schedule repeat.
+    struct Helper {
+        double quote{0.0};
+        double tau{0.0};
+        double pillar{0.0};
+        std::vector<double> times;                // cashflow times, indexed by spec
+        std::vector<Term> spec;                   // terms over indices into times
+        std::vector<Term> terms;                  // terms over shared nodes, after layout
+        std::vector<std::uint32_t> ids;           // shared term of each of terms
+        std::vector<std::uint32_t> segment_begin; // terms of segment m: [segment_begin[m], segment_begin[m + 1])
+        std::vector<double> partial_p, partial_q;
+    };
+
+    static std::uint32_t time_index(Helper& h, double t);
+    std::size_t add(Helper h);
+    void layout();
+    // Solves pillar k (from <= k) given the earlier ones, re-summing the segments from `from` on, and leaves
+    // the cached nodes and terms of segment k at the solution.
+    void solve(std::size_t k, std::size_t from);
+    double y(const Node& n) const;
+    // Recomputes the cached values of the nodes on segment k from the current pillar rates.
+    // and the values of the shared terms paid on it; shift moves them by a converged rate step.
+    void refresh(std::size_t k);
+    void shift(std::size_t k, double step);
+    void value_terms(std::size_t k);
+    // Residual of pillar k's instrument and its derivative in q[k], from the partial sums p and q
+    // of the earlier segments and the nodes of segment k at the current trial rate.
+    double residual(const Helper& h, std::size_t k, double p, double q, double& derivative);
+
+    CurveInterpolation interpolation_;
+    BootstrapSettings settings_;
+    std::vector<Helper> helpers_;
+    std::vector<std::size_t> order_;    // helper of each pillar
+    std::vector<std::size_t> position_; // pillar of each helper
+    std::vector<double> times_;
+    std::vector<double> rates_;
+    // Distinct cashflow times of all instruments in time order, with -ln P and P cached once the
+    // pillars of their segment are solved; nodes of segment m: [segment_nodes_[m], segment_nodes_[m + 1]).
+    std::vector<Node> nodes_;
+    std::vector<double> node_y_, node_df_;
+    std::vector<std::uint32_t> segment_nodes_;
+    // Distinct terms ordered by the segment of their payment node, with their quote-free and
+    // quote-scaled values; terms of segment m: [segment_terms_[m], segment_terms_[m + 1]).
+    std::vector<Term> terms_;
+    std::vector<double> term_p_, term_q_;
+    std::vector<std::uint32_t> segment_terms_;
+    bool laid_out_{false};
+    std::size_t dirty_from_{0};
+    YieldCurve curve_;
+};
+
+} // namespace quant::market
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace quant::market {
+
+template <typename T>
+class BasicYieldCurve;
+using YieldCurve = BasicYieldCurve<double>;
+
+template <typename T>
+class BasicVolSurface;
+using VolSurface = BasicVolSurface<double>;
+
+} // namespace quant::market
@@ -29,10 +29,14 @@ private:
     double spot_;
 };
 
+// Market objects by name. Curves and surfaces loaded by MarketDataFile::map share ownership of
+// the mapping, so the file stays mapped while any of them, or any copy of them, is alive.
 class MarketData {
 public:
     void add_yield_curve(const std::string& name, YieldCurve curve) { curves_[name] = std::move(curve); }
     void add_vol_surface(const std::string& name, VolSurface surface) { surfaces_[name] = std::move(surface); }
+    void add_fx_spot(FXSpot spot) { fx_spots_.insert_or_assign(spot.pair(), std::move(spot)); }
+    void add_equity_spot(EquitySpot spot) { equity_spots_.insert_or_assign(spot.ticker(), std::move(spot)); }
 
     const YieldCurve* yield_curve(const std::string& name) const {
         auto it = curves_.find(name);
@@ -44,9 +48,23 @@ public:
         return it == surfaces_.end() ? nullptr : &it->second;
     }
 
+    const FXSpot* fx_spot(const std::string& pair) const {
+        auto it = fx_spots_.find(pair);
+        return it == fx_spots_.end() ? nullptr : &it->second;
+    }
+
+    const EquitySpot* equity_spot(const std::string& ticker) const {
+        auto it = equity_spots_.find(ticker);
+        return it == equity_spots_.end() ? nullptr : &it->second;
+    }
+
 private:
+    friend class MarketDataFile;
+
     std::unordered_map<std::string, YieldCurve> curves_;
     std::unordered_map<std::string, VolSurface> surfaces_;
+    std::unordered_map<std::string, FXSpot> fx_spots_;
+    std::unordered_map<std::string, EquitySpot> equity_spots_;
 };
 
 } // namespace quant::market
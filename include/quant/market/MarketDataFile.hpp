@@ -0,0 +1,29 @@
+#pragma once
+
+#include "quant/market/MarketData.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace quant::market {
+
+// Binary snapshot of a MarketData: curves and surfaces together with their lookup tables, FX and
+// equity spots, in a versioned, checksummed file. map() maps the file read-only and the curves
+// and surfaces it returns borrow their arrays from the mapping (and keep it mapped), so loading does no parsing or
+// table building and processes mapping one file share it in the page cache. Files use the host's
+// endianness and struct layout; map() rejects one written with another.
+class MarketDataFile {
+public:
+    static constexpr std::uint32_t format_version = 1;
+
+    // Writes to a temporary next to path and renames it over path, so processes that have the old
+    // file mapped keep reading it unchanged.
+    static void write(const MarketData& data, const std::string& path);
+    // verify = false skips the checksum pass over the file.
+    static MarketData map(const std::string& path, bool verify = true);
+
+private:
+    struct Codec;
+};
+
+} // namespace quant::market
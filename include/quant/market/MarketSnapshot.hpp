@@ -0,0 +1,113 @@
+#pragma once
+
+#include "quant/market/VolSurface.hpp"
+#include "quant/market/YieldCurve.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace quant::market {
+
+// Interned names: indices into every snapshot of the store that issued them.
+struct CurveHandle {
+    std::uint32_t index;
+};
+struct SurfaceHandle {
+    std::uint32_t index;
+};
+
+// One immutable version of the market. Objects are shared between versions, so a snapshot stays
+// valid, and its pointers stable, for as long as a reader holds it.
+class MarketSnapshot {
+public:
+    std::uint64_t version() const { return version_; }
+
+    // nullptr if nothing was published under the handle as of this version.
+    const YieldCurve* yield_curve(CurveHandle h) const {
+        return h.index < curves_.size() ? curves_[h.index].get() : nullptr;
+    }
+    const VolSurface* vol_surface(SurfaceHandle h) const {
+        return h.index < surfaces_.size() ? surfaces_[h.index].get() : nullptr;
+    }
+
+private:
+    friend class MarketDataStore;
+
+    std::uint64_t version_{0};
+    std::vector<std::shared_ptr<const YieldCurve>> curves_;
+    std::vector<std::shared_ptr<const VolSurface>> surfaces_;
+};
+
+class MarketDataStore;
+
+// Changes published together as one version by commit().
+class MarketUpdate {
+public:
+    MarketUpdate& set(CurveHandle h, YieldCurve curve);
+    MarketUpdate& set(SurfaceHandle h, VolSurface surface);
+    std::uint64_t commit();
+
+private:
+    friend class MarketDataStore;
+    explicit MarketUpdate(MarketDataStore& store) : store_(&store) {}
+
+    MarketDataStore* store_;
+    std::vector<std::pair<std::uint32_t, std::shared_ptr<const YieldCurve>>> curves_;
+    std::vector<std::pair<std::uint32_t, std::shared_ptr<const VolSurface>>> surfaces_;
+};
+
+// Curves and surfaces by interned handle, published as immutable versioned snapshots. Writers
+// copy the current snapshot's pointer tables under a writer mutex and swap the result in
+// atomically; readers load the current snapshot without taking any lock and keep it as long as
+// they like. Interning and publishing are writer operations.
+class MarketDataStore {
+public:
+    MarketDataStore();
+
+    // The handle of a name, interning it on first use.
+    CurveHandle curve_handle(std::string_view name);
+    SurfaceHandle surface_handle(std::string_view name);
+
+    void publish(CurveHandle h, YieldCurve curve) { update().set(h, std::move(curve)).commit(); }
+    void publish(SurfaceHandle h, VolSurface surface) { update().set(h, std::move(surface)).commit(); }
+    MarketUpdate update() { return MarketUpdate(*this); }
+
+    std::shared_ptr<const MarketSnapshot> snapshot() const { return current_.load(std::memory_order_acquire); }
+    std::uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+private:
+    friend class MarketUpdate;
+    std::uint64_t commit(MarketUpdate& update);
+
+    std::mutex writer_;
+    std::unordered_map<std::string, std::uint32_t> curve_names_;
+    std::unordered_map<std::string, std::uint32_t> surface_names_;
+    std::atomic<std::shared_ptr<const MarketSnapshot>> current_;
+    std::atomic<std::uint64_t> version_{0};
+};
+
+// A reader's pinned snapshot, refreshed only when the store's version has moved: the steady-state
+// cost of current() is one atomic load. One reader per thread.
+class MarketReader {
+public:
+    explicit MarketReader(const MarketDataStore& store) : store_(&store), snapshot_(store.snapshot()) {}
+
+    const MarketSnapshot& current() {
+        if (store_->version() != snapshot_->version()) snapshot_ = store_->snapshot();
+        return *snapshot_;
+    }
+    const MarketSnapshot& pinned() const { return *snapshot_; }
+
+private:
+    const MarketDataStore* store_;
+    std::shared_ptr<const MarketSnapshot> snapshot_;
+};
+
+} // namespace quant::market
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Math.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace quant::market {
+
+// What pricers read from a curve and a surface. BasicYieldCurve, BasicVolSurface and the views
+// below all qualify, so a pricer templated on these reads shocked market data without copies.
+template <typename C>
+concept DiscountCurve = requires(const C& c, double t) {
+    c.discount(t);
+    c.zero_rate(t);
+    c.forward_rate(t, t);
+};
+
+template <typename S>
+concept VolatilitySurface = requires(const S& s, double strike, double tenor) { s.volatility(strike, tenor); };
+
+// Constant zero rate and vol, for instruments quoted with a flat rate or vol.
+struct FlatYieldCurve {
+    double rate{0.0};
+
+    double discount(double t) const { return std::exp(-rate * t); }
+    double zero_rate(double) const { return rate; }
+    double forward_rate(double t1, double t2) const { return t2 <= t1 ? 0.0 : rate; }
+};
+
+struct FlatVolSurface {
+    double vol{0.0};
+
+    double volatility(double, double) const { return vol; }
+};
+
+// Zero-rate shift s(t) = parallel + twist (t - pivot) + bucketed(t), the bucket shifts linear in t
+// between bucket times and flat outside them. Rates are decimal; the buckets are not owned.
+struct CurveShift {
+    double parallel{0.0};
+    double twist{0.0}; // per year of maturity
+    double pivot{0.0};
+    std::span<const double> bucket_times{}; // increasing
+    std::span<const double> bucket_shifts{};
+
+    double operator()(double t) const {
+        double s = parallel + twist * (t - pivot);
+        if (bucket_times.empty()) return s;
+        if (t <= bucket_times.front()) return s + bucket_shifts.front();
+        if (t >= bucket_times.back()) return s + bucket_shifts.back();
+        auto i = static_cast<std::size_t>(std::upper_bound(bucket_times.begin(), bucket_times.end(), t) -
+                                          bucket_times.begin());
+        double w = (t - bucket_times[i - 1]) / (bucket_times[i] - bucket_times[i - 1]);
+        return s + bucket_shifts[i - 1] + w * (bucket_shifts[i] - bucket_shifts[i - 1]);
+    }
+};
+
+// A curve read through a zero-rate shift: z'(t) = z(t) + s(t), so P'(t) = P(t) exp(-s(t) t).
+// Holds a pointer to the base curve, which must outlive the view, and allocates nothing.
+template <DiscountCurve Curve>
+class ShiftedYieldCurve {
+public:
+    using value_type = decltype(std::declval<const Curve&>().zero_rate(0.0));
+
+    ShiftedYieldCurve(const Curve& base, CurveShift shift) : base_(&base), shift_(shift) {
+        if (shift_.bucket_times.size() != shift_.bucket_shifts.size()) {
+            throw quant::core::DataError("Curve shift bucket size mismatch");
+        }
+    }
+
+    value_type discount(double t) const { return base_->discount(t) * Scalar(std::exp(-shift_(t) * t)); }
+    value_type zero_rate(double t) const { return base_->zero_rate(t) + Scalar(shift_(t)); }
+    value_type forward_rate(double t1, double t2) const {
+        if (t2 <= t1) return base_->forward_rate(t1, t2);
+        return base_->forward_rate(t1, t2) + Scalar((shift_(t2) * t2 - shift_(t1) * t1) / (t2 - t1));
+    }
+
+    const Curve& base() const { return *base_; }
+    const CurveShift& shift() const { return shift_; }
+
+private:
+    using Scalar = quant::core::scalar_t<value_type>;
+
+    const Curve* base_;
+    CurveShift shift_;
+};
+
+// A surface read as vol(K, T) scale + shift; same ownership as ShiftedYieldCurve.
+template <VolatilitySurface Surface>
+class ScaledVolSurface {
+public:
+    using value_type = decltype(std::declval<const Surface&>().volatility(0.0, 0.0));
+
+    ScaledVolSurface(const Surface& base, double scale, double shift = 0.0)
+        : base_(&base), scale_(scale), shift_(shift) {}
+
+    value_type volatility(double strike, double tenor) const {
+        return base_->volatility(strike, tenor) * Scalar(scale_) + Scalar(shift_);
+    }
+
+    const Surface& base() const { return *base_; }
+
+private:
+    using Scalar = quant::core::scalar_t<value_type>;
+
+    const Surface* base_;
+    double scale_;
+    double shift_;
+};
+
+} // namespace quant::market
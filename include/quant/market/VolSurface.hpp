@@ -1,28 +1,296 @@
 #pragma once
 
+#include "quant/core/Buffer.hpp"
 #include "quant/core/Exceptions.hpp"
+#include "quant/core/Math.hpp"
+#include "quant/market/Fwd.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace quant::market {
 
-class VolSurface {
+enum class VolInterpolation {
+    Bilinear,       // linear in strike and in tenor
+    VarianceLinear, // linear in strike, total variance vol^2 T linear in tenor
+    Bicubic         // bicubic Hermite on finite-difference node slopes
+};
+
+template <typename T>
+class BasicVolSlice;
+
+// Strike x tenor grid, flat beyond the edges, stored row-major by strike with the inverse grid
+// spacings precomputed. slice() fixes the tenor for many strikes at one maturity and the span
+// overload walks sorted queries with a hint. T is the type of the node vols, e.g. core::Real
+// for sensitivities to every node.
+template <typename T>
+class BasicVolSurface {
+    using Scalar = quant::core::scalar_t<T>;
+
 public:
-    VolSurface() = default;
-    VolSurface(std::vector<double> strikes, std::vector<double> tenors, std::vector<std::vector<double>> vols);
+    BasicVolSurface() = default;
+    // vols[i * tenors.size() + j] is the vol at strike i, tenor j.
+    BasicVolSurface(std::vector<double> strikes, std::vector<double> tenors, std::vector<T> vols,
+                    VolInterpolation interpolation = VolInterpolation::Bilinear)
+        : strikes_(std::move(strikes)), tenors_(std::move(tenors)), vols_(std::move(vols)),
+          interpolation_(interpolation) {
+        if (vols_.size() != strikes_.size() * tenors_.size()) {
+            throw quant::core::DataError("Vol grid size mismatch");
+        }
+        build();
+    }
+    // vols[i][j] is the vol at strike i, tenor j.
+    BasicVolSurface(std::vector<double> strikes, std::vector<double> tenors, const std::vector<std::vector<T>>& vols,
+                    VolInterpolation interpolation = VolInterpolation::Bilinear)
+        : BasicVolSurface(std::move(strikes), tenors, flatten(vols, tenors.size()), interpolation) {}
 
-    double volatility(double strike, double tenor) const;
+    T volatility(double strike, double tenor) const {
+        check();
+        Bracket t = tenor_bracket(tenor);
+        Bracket k = strike_bracket(strike);
+        return across(at_tenor(k.lo, t, tenor), at_tenor(k.hi, t, tenor), k);
+    }
+    // Vols at (strikes[i], tenors[i]); out must have the size of strikes. Fastest with the queries
+    // sorted by tenor, then strike.
+    void volatility(std::span<const double> strikes, std::span<const double> tenors, std::span<T> out) const {
+        if (strikes.size() != tenors.size() || strikes.size() != out.size()) {
+            throw quant::core::DataError("Vol surface batch size mismatch");
+        }
+        if (out.empty()) return;
+        check();
+        Bracket t = tenor_bracket(tenors[0]), k{};
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            if (i > 0 && tenors[i] != tenors[i - 1]) t = tenor_bracket(tenors[i], t.lo);
+            k = strike_bracket(strikes[i], k.lo);
+            out[i] = across(at_tenor(k.lo, t, tenors[i]), at_tenor(k.hi, t, tenors[i]), k);
+        }
+    }
+    // Interpolates every strike node at tenor once; the slice reads the surface's strike grid.
+    BasicVolSlice<T> slice(double tenor) const;
 
-    const std::vector<double>& strikes() const { return strikes_; }
-    const std::vector<double>& tenors() const { return tenors_; }
-    const std::vector<std::vector<double>>& vols() const { return vols_; }
+    std::span<const double> strikes() const { return strikes_; }
+    std::span<const double> tenors() const { return tenors_; }
+    std::span<const T> grid() const { return vols_; }
+    const T& vol(std::size_t strike_index, std::size_t tenor_index) const {
+        return vols_[strike_index * tenors_.size() + tenor_index];
+    }
+    VolInterpolation interpolation() const { return interpolation_; }
 
 private:
-    double bilinear(double strike, double tenor) const;
+    friend class BasicVolSlice<T>;
+    friend class MarketDataFile;
+
+    // x between nodes lo and hi = lo + 1 at weight w of hi; lo == hi, w = 0 on and beyond the edges.
+    struct Bracket {
+        std::size_t lo{0};
+        std::size_t hi{0};
+        double w{0.0};
+        double width{0.0};
+    };
+    // Value and strike slope at one strike node, interpolated to a tenor.
+    struct Node {
+        T value;
+        T slope;
+    };
+
+    static std::vector<T> flatten(const std::vector<std::vector<T>>& vols, std::size_t tenors) {
+        std::vector<T> flat;
+        flat.reserve(vols.size() * tenors);
+        for (const auto& row : vols) {
+            if (row.size() != tenors) throw quant::core::DataError("Vol grid size mismatch (tenors)");
+            flat.insert(flat.end(), row.begin(), row.end());
+        }
+        return flat;
+    }
+
+    void build();
+
+    void check() const {
+        if (strikes_.empty() || tenors_.empty()) throw quant::core::DataError("Empty vol surface");
+    }
+
+    // Inverse node spacings and a uniform bucket index over one axis, as in BasicYieldCurve.
+    struct Axis {
+        quant::core::Buffer<double> inv;           // 1 / node spacing
+        quant::core::Buffer<std::uint32_t> bucket; // first interval of each uniform bucket
+        double inv_bucket{0.0};
+
+        void build(std::span<const double> x, const char* what);
+        Bracket find(std::span<const double> x, double v, std::size_t hint) const {
+            const std::size_t n = x.size();
+            if (!(v > x.front())) return {0, 0, 0.0, 0.0};
+            if (v >= x.back()) return {n - 1, n - 1, 0.0, 0.0};
+            std::size_t i = hint;
+            if (!(i + 1 < n && x[i] <= v && v < x[i + 1])) {
+                auto b = static_cast<std::size_t>((v - x.front()) * inv_bucket);
+                i = bucket[std::min(b, bucket.size() - 1)];
+                while (x[i + 1] <= v) ++i;
+                while (x[i] > v) --i;
+            }
+            return {i, i + 1, (v - x[i]) * inv[i], x[i + 1] - x[i]};
+        }
+    };
+
+    Bracket strike_bracket(double strike, std::size_t hint = 0) const { return strike_axis_.find(strikes_, strike, hint); }
+    Bracket tenor_bracket(double tenor, std::size_t hint = 0) const { return tenor_axis_.find(tenors_, tenor, hint); }
+
+    Node at_tenor(std::size_t i, const Bracket& t, double tenor) const {
+        using std::sqrt;
+        const T& a = vol(i, t.lo);
+        const T& b = vol(i, t.hi);
+        const Scalar w(t.w), zero(0);
+        switch (interpolation_) {
+        case VolInterpolation::Bilinear:
+            return {a + w * (b - a), T(zero)};
+        case VolInterpolation::VarianceLinear: {
+            if (t.lo == t.hi) return {a, T(zero)};
+            T va = a * a * Scalar(tenors_[t.lo]), vb = b * b * Scalar(tenors_[t.hi]);
+            return {sqrt((va + w * (vb - va)) / Scalar(tenor)), T(zero)};
+        }
+        case VolInterpolation::Bicubic: {
+            const std::size_t ia = i * tenors_.size() + t.lo, ib = i * tenors_.size() + t.hi;
+            Hermite h(t.w, t.width);
+            return {h(a, b, d_tenor_[ia], d_tenor_[ib]), h(d_strike_[ia], d_strike_[ib], d_cross_[ia], d_cross_[ib])};
+        }
+        }
+        return {a, T(zero)};
+    }
+
+    T across(const Node& a, const Node& b, const Bracket& k) const {
+        if (interpolation_ == VolInterpolation::Bicubic) return Hermite(k.w, k.width)(a.value, b.value, a.slope, b.slope);
+        return a.value + Scalar(k.w) * (b.value - a.value);
+    }
+
+    // Cubic Hermite basis at x in [0, 1] over an interval of the given width.
+    struct Hermite {
+        Scalar h00, h01, h10, h11;
+        Hermite(double x, double width) {
+            double x2 = x * x, x3 = x2 * x;
+            h00 = Scalar(2 * x3 - 3 * x2 + 1);
+            h01 = Scalar(-2 * x3 + 3 * x2);
+            h10 = Scalar((x3 - 2 * x2 + x) * width);
+            h11 = Scalar((x3 - x2) * width);
+        }
+        T operator()(const T& a, const T& b, const T& da, const T& db) const {
+            return h00 * a + h01 * b + h10 * da + h11 * db;
+        }
+    };
 
-    std::vector<double> strikes_;
-    std::vector<double> tenors_;
-    std::vector<std::vector<double>> vols_; // vols_[i][j] strike i, tenor j
+    // Owned, or borrowed from a mapped MarketDataFile.
+    quant::core::Buffer<double> strikes_;
+    quant::core::Buffer<double> tenors_;
+    quant::core::Buffer<T> vols_;
+    VolInterpolation interpolation_{VolInterpolation::Bilinear};
+    Axis strike_axis_, tenor_axis_;
+    quant::core::Buffer<T> d_strike_, d_tenor_, d_cross_; // bicubic only: node slopes, laid out as vols_
 };
 
+// The strike nodes of a surface at one tenor, with the strike slopes under bicubic interpolation.
+// Reads the surface's strike grid, so the surface must outlive the slice.
+template <typename T>
+class BasicVolSlice {
+public:
+    double tenor() const { return tenor_; }
+
+    T volatility(double strike) const {
+        auto k = surface_->strike_bracket(strike);
+        return surface_->across(nodes_[k.lo], nodes_[k.hi], k);
+    }
+    // out must have the size of strikes; fastest with sorted strikes.
+    void volatility(std::span<const double> strikes, std::span<T> out) const {
+        if (strikes.size() != out.size()) throw quant::core::DataError("Vol slice batch size mismatch");
+        typename Surface::Bracket k{};
+        for (std::size_t i = 0; i < strikes.size(); ++i) {
+            k = surface_->strike_bracket(strikes[i], k.lo);
+            out[i] = surface_->across(nodes_[k.lo], nodes_[k.hi], k);
+        }
+    }
+
+private:
+    using Surface = BasicVolSurface<T>;
+    friend class BasicVolSurface<T>;
+
+    BasicVolSlice(const Surface& surface, double tenor) : surface_(&surface), tenor_(tenor) {}
+
+    const Surface* surface_;
+    double tenor_;
+    std::vector<typename Surface::Node> nodes_;
+};
+
+template <typename T>
+BasicVolSlice<T> BasicVolSurface<T>::slice(double tenor) const {
+    check();
+    BasicVolSlice<T> s(*this, tenor);
+    Bracket t = tenor_bracket(tenor);
+    s.nodes_.reserve(strikes_.size());
+    for (std::size_t i = 0; i < strikes_.size(); ++i) s.nodes_.push_back(at_tenor(i, t, tenor));
+    return s;
+}
+
+template <typename T>
+void BasicVolSurface<T>::Axis::build(std::span<const double> x, const char* what) {
+    const std::size_t n = x.size();
+    inv.assign(n < 2 ? 0 : n - 1, 0.0);
+    bucket.assign(0, 0);
+    if (n < 2) return;
+    double* inv_x = inv.edit();
+    double span = x.back() - x.front(), min_gap = span;
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        if (!(x[i + 1] > x[i])) throw quant::core::DataError(std::string("Vol surface ") + what + " must increase");
+        inv_x[i] = 1.0 / (x[i + 1] - x[i]);
+        min_gap = std::min(min_gap, x[i + 1] - x[i]);
+    }
+    // Buckets no wider than the narrowest interval, capped at 16 per interval.
+    auto buckets = static_cast<std::size_t>(std::clamp(std::ceil(span / min_gap), 1.0, 16.0 * static_cast<double>(n - 1)));
+    inv_bucket = static_cast<double>(buckets) / span;
+    bucket.resize(buckets);
+    std::uint32_t* first = bucket.edit();
+    std::size_t i = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+        double start = x.front() + static_cast<double>(b) / inv_bucket;
+        while (i + 2 < n && x[i + 1] <= start) ++i;
+        first[b] = static_cast<std::uint32_t>(i);
+    }
+}
+
+template <typename T>
+void BasicVolSurface<T>::build() {
+    strike_axis_.build(strikes_, "strikes");
+    tenor_axis_.build(tenors_, "tenors");
+    if (interpolation_ == VolInterpolation::VarianceLinear && !tenors_.empty() && !(tenors_.front() >= 0.0)) {
+        throw quant::core::DataError("Vol surface tenors must be non-negative");
+    }
+    if (interpolation_ != VolInterpolation::Bicubic) return;
+
+    // Three-point slopes (one-sided at the edges) along strikes or tenors of a grid laid out as vols_.
+    const std::size_t nk = strikes_.size(), nt = tenors_.size();
+    auto slopes = [&](std::span<const T> f, bool along_strikes) {
+        std::span<const double> x = along_strikes ? strikes_.span() : tenors_.span();
+        const std::size_t n = x.size(), rows = along_strikes ? nt : nk;
+        std::vector<T> d(f.size(), T(Scalar(0)));
+        if (n < 2) return d;
+        for (std::size_t r = 0; r < rows; ++r) {
+            auto at = [&](std::size_t i) -> std::size_t { return along_strikes ? i * nt + r : r * nt + i; };
+            auto secant = [&](std::size_t i) { return (f[at(i + 1)] - f[at(i)]) / Scalar(x[i + 1] - x[i]); };
+            d[at(0)] = secant(0);
+            d[at(n - 1)] = secant(n - 2);
+            for (std::size_t i = 1; i + 1 < n; ++i) {
+                double hl = x[i] - x[i - 1], hr = x[i + 1] - x[i];
+                d[at(i)] = (Scalar(hr) * secant(i - 1) + Scalar(hl) * secant(i)) / Scalar(hl + hr);
+            }
+        }
+        return d;
+    };
+    d_strike_ = slopes(vols_, true);
+    d_tenor_ = slopes(vols_, false);
+    d_cross_ = slopes(d_strike_, false);
+}
+
+extern template class BasicVolSurface<double>;
+
 } // namespace quant::market
@@ -1,30 +1,310 @@
 #pragma once
 
+#include "quant/core/Buffer.hpp"
 #include "quant/core/Date.hpp"
 #include "quant/core/Exceptions.hpp"
+#include "quant/core/Math.hpp"
+#include "quant/core/Simd.hpp"
+#include "quant/market/Fwd.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <type_traits>
 #include <vector>
 
 namespace quant::market {
 
-class YieldCurve {
+enum class CurveInterpolation {
+    LinearZero,        // zero rates linear in time
+    LogLinearDiscount, // ln P(t) linear in time: piecewise-flat forwards
+    MonotoneConvex     // Hagan-West monotone convex forwards, without the positivity collar
+};
+
+// Zero curve through pillar zero rates, flat in the zero rate before the first (linear zero) and
+// after the last pillar. Segment coefficients are computed once at construction; single lookups
+// go through a uniform bucket index and the span overloads walk monotone query streams with a
+// hint. T is the type of the rates: float for screening, core::Real or core::Dual to
+// differentiate with respect to pillars; pillar and query times are doubles.
+template <typename T>
+class BasicYieldCurve {
+    using Scalar = quant::core::scalar_t<T>;
+
 public:
-    YieldCurve() = default;
-    YieldCurve(std::vector<double> times, std::vector<double> zero_rates);
+    BasicYieldCurve() = default;
+    BasicYieldCurve(std::vector<double> times, std::vector<T> zero_rates,
+                    CurveInterpolation interpolation = CurveInterpolation::LinearZero)
+        : times_(std::move(times)), zero_rates_(std::move(zero_rates)), interpolation_(interpolation) {
+        if (times_.size() != zero_rates_.size() || times_.empty()) {
+            throw quant::core::DataError("Invalid yield curve inputs");
+        }
+        for (std::size_t i = 1; i < times_.size(); ++i) {
+            if (!(times_[i] > times_[i - 1])) throw quant::core::DataError("Yield curve times must increase");
+        }
+        if (interpolation_ != CurveInterpolation::LinearZero && !(times_.front() > 0.0)) {
+            throw quant::core::DataError("Yield curve times must be positive");
+        }
+        build();
+        index();
+    }
+
+    // Replaces the zero rates, keeping the pillar times and their lookup index.
+    void set_zero_rates(std::span<const T> zero_rates) {
+        if (zero_rates.size() != times_.size()) throw quant::core::DataError("Invalid yield curve inputs");
+        std::copy(zero_rates.begin(), zero_rates.end(), zero_rates_.edit());
+        build();
+    }
+
+    T discount(double t) const { // t in years
+        using std::exp;
+        return exp(-integral(t, locate(t)));
+    }
+    T zero_rate(double t) const { return zero(t, locate(t)); }
+    T forward_rate(double t1, double t2) const {
+        if (t2 <= t1) return T(Scalar(0));
+        return (integral(t2, locate(t2)) - integral(t1, locate(t1))) / Scalar(t2 - t1);
+    }
 
-    double discount(double t) const; // t in years
-    double zero_rate(double t) const;
-    double forward_rate(double t1, double t2) const;
+    // Batch forms, fastest on sorted times; out must have the size of times. For double curves in
+    // SIMD builds the exponentials are vectorised and agree with discount(t) to rounding.
+    void discount(std::span<const double> times, std::span<T> out) const {
+        using std::exp;
+        check(times, out);
+        std::size_t s = times.empty() ? 0 : locate(times[0]);
+        for (std::size_t i = 0; i < times.size(); ++i) {
+            s = advance(times[i], s);
+            out[i] = -integral(times[i], s);
+        }
+        if constexpr (std::is_same_v<T, double> && quant::core::simd::width > 1) {
+            namespace simd = quant::core::simd;
+            constexpr std::size_t W = simd::width;
+            const std::size_t n = out.size();
+            std::size_t i = 0;
+            for (; i + W <= n; i += W) simd::store(out.data() + i, simd::exp(simd::load(out.data() + i)));
+            if (i < n) {
+                double buf[W] = {};
+                std::copy(out.begin() + static_cast<std::ptrdiff_t>(i), out.end(), buf);
+                simd::store(buf, simd::exp(simd::load(buf)));
+                std::copy(buf, buf + (n - i), out.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        } else {
+            for (auto& y : out) y = exp(y);
+        }
+    }
+    void zero_rate(std::span<const double> times, std::span<T> out) const {
+        check(times, out);
+        std::size_t s = times.empty() ? 0 : locate(times[0]);
+        for (std::size_t i = 0; i < times.size(); ++i) {
+            s = advance(times[i], s);
+            out[i] = zero(times[i], s);
+        }
+    }
 
-    const std::vector<double>& times() const { return times_; }
-    const std::vector<double>& zero_rates() const { return zero_rates_; }
+    // d(-ln P(t)) / d z_k, nonzero for pillars lo and lo + 1 only (hi_weight is 0 when lo is the
+    // last pillar). Linear zero and log-linear discount only: monotone convex forwards spread a
+    // pillar over its neighbouring segments.
+    struct PillarWeights {
+        std::size_t lo;
+        double lo_weight;
+        double hi_weight;
+    };
+    PillarWeights pillar_weights(double t) const {
+        if (interpolation_ == CurveInterpolation::MonotoneConvex) {
+            throw quant::core::DataError("Pillar weights need a linear-zero or log-linear curve");
+        }
+        const std::size_t n = times_.size(), s = locate(t);
+        // Flat zero rate before the first and after the last pillar in both modes.
+        if (s == 0) return {0, t, 0.0};
+        if (s == n) return {n - 1, t, 0.0};
+        const double t0 = times_[s - 1], t1 = times_[s], w = (t - t0) / (t1 - t0);
+        if (interpolation_ == CurveInterpolation::LinearZero) return {s - 1, (1.0 - w) * t, w * t};
+        return {s - 1, (1.0 - w) * t0, w * t1};
+    }
+
+    std::span<const double> times() const { return times_; }
+    std::span<const T> zero_rates() const { return zero_rates_; }
+    CurveInterpolation interpolation() const { return interpolation_; }
 
 private:
-    double interpolate(double t) const;
+    friend class MarketDataFile;
+
+    // Segment s covers [times_[s - 1], times_[s]); segment 0 is everything before the first pillar
+    // and segment n everything from the last. Linear zero: z = a + b (t - start). Other modes:
+    // -ln P = a + b (t - start) + width G(x), x = (t - start) / width, G = 0 outside monotone convex.
+    struct Segment {
+        double start;
+        double width;
+        T a;
+        T b;
+    };
+    // Hagan-West forward correction g(x) on one segment, integrated: quadratic shape, or
+    // level + left decay over [0, eta] + right rise over [eta, 1].
+    struct Shape {
+        std::uint8_t kind; // 0 none, 1 quadratic, 2 piecewise
+        T g0, g1;
+        T level, left, right;
+        T eta;
+    };
+
+    void build();
+    void index();
+
+    std::size_t locate(double t) const {
+        const std::size_t n = times_.size();
+        if (!(t >= times_.front())) return 0;
+        if (t >= times_.back()) return n;
+        auto b = static_cast<std::size_t>((t - times_.front()) * inv_bucket_);
+        std::size_t s = bucket_[std::min(b, bucket_.size() - 1)];
+        while (times_[s] <= t) ++s;
+        while (times_[s - 1] > t) --s;
+        return s;
+    }
+    // Segment of t starting from the segment of the previous query.
+    std::size_t advance(double t, std::size_t s) const {
+        const std::size_t n = times_.size();
+        while (s < n && times_[s] <= t) ++s;
+        return s == 0 || times_[s - 1] <= t ? s : locate(t);
+    }
 
-    std::vector<double> times_;
-    std::vector<double> zero_rates_;
+    T integral(double t, std::size_t s) const {
+        const Segment& seg = segments_[s];
+        if (interpolation_ == CurveInterpolation::LinearZero) {
+            return (seg.a + seg.b * Scalar(t - seg.start)) * Scalar(t);
+        }
+        if (t <= 0.0) return front_rate_ * Scalar(t);
+        T y = seg.a + seg.b * Scalar(t - seg.start);
+        if (!shapes_.empty() && shapes_[s].kind != 0) {
+            y += Scalar(seg.width) * shape_integral(shapes_[s], (t - seg.start) / seg.width);
+        }
+        return y;
+    }
+    T zero(double t, std::size_t s) const {
+        const Segment& seg = segments_[s];
+        if (interpolation_ == CurveInterpolation::LinearZero) return seg.a + seg.b * Scalar(t - seg.start);
+        if (t <= 0.0) return front_rate_;
+        return integral(t, s) / Scalar(t);
+    }
+
+    static T shape_integral(const Shape& sh, double xd) {
+        const Scalar x(xd), zero(0), one(1), three(3);
+        if (sh.kind == 1) return sh.g0 * (x * (one - x) * (one - x)) + sh.g1 * (x * x * (x - one));
+        T g = sh.level * x;
+        if (sh.eta > zero) {
+            T u = x < sh.eta ? T(one - x / sh.eta) : T(zero);
+            g += sh.left * (sh.eta / three * (one - u * u * u));
+        }
+        if (sh.eta < x) {
+            T v = x - sh.eta, w = one - sh.eta;
+            g += sh.right * (v * v * v / (three * w * w));
+        }
+        return g;
+    }
+
+    static void check(std::span<const double> times, std::span<T> out) {
+        if (times.size() != out.size()) throw quant::core::DataError("Yield curve batch size mismatch");
+    }
+
+    // Owned, or borrowed from a mapped MarketDataFile.
+    quant::core::Buffer<double> times_;
+    quant::core::Buffer<T> zero_rates_;
+    CurveInterpolation interpolation_{CurveInterpolation::LinearZero};
+    quant::core::Buffer<Segment> segments_;      // n + 1
+    quant::core::Buffer<Shape> shapes_;          // n + 1 for monotone convex, else empty
+    quant::core::Buffer<std::uint32_t> bucket_;  // first segment of each uniform bucket of [t_0, t_n-1)
+    double inv_bucket_{0.0};
+    T front_rate_{};                     // zero rate as t -> 0
 };
 
-} // namespace quant::market
+template <typename T>
+void BasicYieldCurve<T>::build() {
+    const std::size_t n = times_.size();
+    const Scalar zero(0), half(0.5), two(2);
+    segments_.assign(n + 1, Segment{times_.front(), 1.0, zero_rates_.front(), T(zero)});
+    Segment* segments = segments_.edit();
+    front_rate_ = zero_rates_.front();
+    if (interpolation_ == CurveInterpolation::LinearZero) {
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            segments[i + 1] = {times_[i], times_[i + 1] - times_[i], zero_rates_[i],
+                                (zero_rates_[i + 1] - zero_rates_[i]) / Scalar(times_[i + 1] - times_[i])};
+        }
+        segments[n] = {times_.back(), 1.0, zero_rates_.back(), T(zero)};
+    } else {
+        // Knots 0 = tau_0 < tau_1 = t_0 < ..., y = -ln P at the knots, fd = discrete forwards.
+        std::vector<T> y(n + 1, T(zero)), fd(n + 1, T(zero));
+        std::vector<double> tau(n + 1, 0.0);
+        for (std::size_t i = 1; i <= n; ++i) {
+            tau[i] = times_[i - 1];
+            y[i] = zero_rates_[i - 1] * Scalar(tau[i]);
+            fd[i] = (y[i] - y[i - 1]) / Scalar(tau[i] - tau[i - 1]);
+        }
+        for (std::size_t i = 1; i <= n; ++i) segments[i - 1] = {tau[i - 1], tau[i] - tau[i - 1], y[i - 1], fd[i]};
+        segments[n] = {times_.back(), 1.0, y[n], zero_rates_.back()};
+
+        if (interpolation_ == CurveInterpolation::MonotoneConvex && n > 1) {
+            // Instantaneous forwards at the knots, then the Hagan-West shape of each segment.
+            std::vector<T> f(n + 1, T(zero));
+            for (std::size_t i = 1; i < n; ++i) {
+                Scalar wl = Scalar((tau[i] - tau[i - 1]) / (tau[i + 1] - tau[i - 1]));
+                f[i] = wl * fd[i + 1] + (Scalar(1) - wl) * fd[i];
+            }
+            f[0] = fd[1] - half * (f[1] - fd[1]);
+            f[n] = fd[n] - half * (f[n - 1] - fd[n]);
+            front_rate_ = f[0];
+            shapes_.assign(n + 1, Shape{0, T(zero), T(zero), T(zero), T(zero), T(zero), T(zero)});
+            Shape* shapes = shapes_.edit();
+            for (std::size_t i = 1; i <= n; ++i) {
+                Shape& sh = shapes[i - 1];
+                T g0 = f[i - 1] - fd[i], g1 = f[i] - fd[i];
+                sh.g0 = g0;
+                sh.g1 = g1;
+                if (g0 == zero && g1 == zero) {
+                    sh.kind = 0;
+                } else if ((g0 < zero && -half * g0 <= g1 && g1 <= -two * g0) ||
+                           (g0 > zero && -half * g0 >= g1 && g1 >= -two * g0)) {
+                    sh.kind = 1;
+                } else if ((g0 < zero && g1 > -two * g0) || (g0 > zero && g1 < -two * g0)) {
+                    sh.kind = 2;
+                    sh.eta = (g1 + two * g0) / (g1 - g0);
+                    sh.level = g0;
+                    sh.right = g1 - g0;
+                } else if ((g0 > zero && g1 < zero) || (g0 < zero && g1 > zero)) {
+                    sh.kind = 2;
+                    sh.eta = Scalar(3) * g1 / (g1 - g0);
+                    sh.level = g1;
+                    sh.left = g0 - g1;
+                } else {
+                    sh.kind = 2;
+                    sh.eta = g1 / (g1 + g0);
+                    sh.level = -g0 * g1 / (g0 + g1);
+                    sh.left = g0 - sh.level;
+                    sh.right = g1 - sh.level;
+                }
+            }
+        }
+    }
 
+}
+
+template <typename T>
+void BasicYieldCurve<T>::index() {
+    const std::size_t n = times_.size();
+    if (n < 2) return;
+    // Buckets no wider than the shortest segment, capped at 16 per segment.
+    double span = times_.back() - times_.front(), min_gap = span;
+    for (std::size_t i = 1; i < n; ++i) min_gap = std::min(min_gap, times_[i] - times_[i - 1]);
+    auto buckets = static_cast<std::size_t>(std::clamp(std::ceil(span / min_gap), 1.0, 16.0 * static_cast<double>(n)));
+    inv_bucket_ = static_cast<double>(buckets) / span;
+    bucket_.resize(buckets);
+    std::uint32_t* bucket = bucket_.edit();
+    std::size_t s = 1;
+    for (std::size_t b = 0; b < buckets; ++b) {
+        double start = times_.front() + static_cast<double>(b) / inv_bucket_;
+        while (s < n - 1 && times_[s] <= start) ++s;
+        bucket[b] = static_cast<std::uint32_t>(s);
+    }
+}
+
+extern template class BasicYieldCurve<double>;
+
+} // namespace quant::market
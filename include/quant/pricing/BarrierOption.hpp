@@ -3,8 +3,11 @@
 #include "quant/instruments/BarrierOption.hpp"
 #include "quant/pricing/PricingEngine.hpp"
 
+#include <cstddef>
+
 namespace quant::pricing {
 
+// CRR binomial tree; converges slowly because nodes do not line up with the barrier.
 class BarrierOptionEngine : public PricingEngine {
 public:
     BarrierOptionEngine(std::size_t steps = 200) : steps_(steps) {}
@@ -13,8 +16,27 @@ public:
     double price(const quant::instruments::BarrierOption& opt) const;
 
 private:
+    // Knock-out worth hit_value on the barrier; pays the rebate instead of the vanilla payoff at
+    // expiry when pay_rebate is set.
+    double knock_out(const quant::instruments::BarrierOption& opt, quant::instruments::BarrierType type,
+                     double hit_value, bool pay_rebate) const;
+
     std::size_t steps_;
 };
 
-} // namespace quant::pricing
+// Closed-form Reiner-Rubinstein prices for continuously monitored barriers (Haug's formulation).
+// Knock-out rebates are paid at the hit, knock-in rebates at expiry if the barrier was never hit.
+// With monitoring_points m > 0 the barrier is moved away from spot by exp(0.5826 vol sqrt(T / m))
+// (Broadie-Glasserman-Kou) to approximate monitoring on m equally spaced dates.
+class AnalyticBarrierEngine : public PricingEngine {
+public:
+    explicit AnalyticBarrierEngine(std::size_t monitoring_points = 0) : monitoring_points_(monitoring_points) {}
 
+    double price(const quant::instruments::Instrument& inst) const override;
+    double price(const quant::instruments::BarrierOption& opt) const;
+
+private:
+    std::size_t monitoring_points_;
+};
+
+} // namespace quant::pricing
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "quant/instruments/EuropeanOption.hpp"
+#include "quant/market/Views.hpp"
 #include "quant/market/YieldCurve.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
 #include "quant/pricing/PricingEngine.hpp"
 
 namespace quant::pricing {
@@ -12,13 +14,29 @@ public:
     double price(const quant::instruments::Instrument& inst) const override;
 
     double price(const quant::instruments::EuropeanOption& opt) const;
+    BSResult price_and_greeks(const quant::instruments::EuropeanOption& opt) const;
     double delta(const quant::instruments::EuropeanOption& opt) const;
     double gamma(const quant::instruments::EuropeanOption& opt) const;
     double vega(const quant::instruments::EuropeanOption& opt) const;
     double theta(const quant::instruments::EuropeanOption& opt) const;
     double rho(const quant::instruments::EuropeanOption& opt) const;
+    // Value at the given spot with the rate and vol read from curve and surface (any curve or
+    // surface view) instead of the engine's curve and the option's own rate and vol.
+    template <quant::market::DiscountCurve Curve, quant::market::VolatilitySurface Surface>
+    double price(const quant::instruments::EuropeanOption& opt, double spot, const Curve& curve,
+                 const Surface& surface) const {
+        return black_scholes<BSPrice>(opt.option_type(), spot, opt.strike(), opt.maturity(),
+                                      curve.zero_rate(opt.maturity()), opt.dividend(),
+                                      surface.volatility(opt.strike(), opt.maturity()))
+            .price;
+    }
+
+    const quant::market::YieldCurve* curve() const { return curve_; }
 
 private:
+    template <unsigned Outputs>
+    BSResult evaluate(const quant::instruments::EuropeanOption& opt) const;
+
     const quant::market::YieldCurve* curve_;
 };
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "quant/instruments/EuropeanOption.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace quant::pricing {
+
+// Structure-of-arrays view over an option chain; every span must have the same length.
+struct OptionChainView {
+    std::span<const double> spot;
+    std::span<const double> strike;
+    std::span<const double> maturity;
+    std::span<const double> rate;
+    std::span<const double> vol;
+    std::span<const double> dividend;
+    std::span<const quant::instruments::OptionType> type;
+
+    std::size_t size() const { return spot.size(); }
+};
+
+// Owning structure-of-arrays option chain.
+class OptionChain {
+public:
+    void reserve(std::size_t n);
+    void push_back(quant::instruments::OptionType type, double spot, double strike, double maturity,
+                   double rate, double vol, double dividend = 0.0);
+    // Rate and vol as EuropeanOption::npv sees them: read from the attached yield curve and vol
+    // surface when set, once, at insertion; later changes to the curve or surface are not seen.
+    void push_back(const quant::instruments::EuropeanOption& opt);
+
+    std::size_t size() const { return spot_.size(); }
+    OptionChainView view() const;
+
+private:
+    std::vector<double> spot_;
+    std::vector<double> strike_;
+    std::vector<double> maturity_;
+    std::vector<double> rate_;
+    std::vector<double> vol_;
+    std::vector<double> dividend_;
+    std::vector<quant::instruments::OptionType> type_;
+};
+
+// Output arrays; empty spans are skipped. Options with maturity <= 0 or vol <= 0 get zeros.
+struct BlackScholesBatchOutput {
+    std::span<double> price;
+    std::span<double> delta;
+    std::span<double> gamma;
+    std::span<double> vega;
+    std::span<double> theta;
+    std::span<double> rho;
+};
+
+// Vectorised Black-Scholes over option chains, split across threads (0 = all hardware threads).
+class BlackScholesBatchEngine {
+public:
+    explicit BlackScholesBatchEngine(std::size_t threads = 0, std::size_t min_block = 4096)
+        : threads_(threads), min_block_(min_block) {}
+
+    void price(const OptionChainView& chain, std::span<double> prices) const;
+    void price(const OptionChainView& chain, const BlackScholesBatchOutput& out) const;
+
+private:
+    std::size_t threads_;
+    std::size_t min_block_;
+};
+
+} // namespace quant::pricing
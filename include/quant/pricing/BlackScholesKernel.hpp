@@ -0,0 +1,82 @@
+#pragma once
+
+#include "quant/core/Math.hpp"
+#include "quant/instruments/EuropeanOption.hpp"
+
+#include <cmath>
+
+namespace quant::pricing {
+
+// Output selection flags for black_scholes<Outputs>(); unrequested fields stay zero.
+enum BSOutput : unsigned {
+    BSPrice = 1u << 0,
+    BSDelta = 1u << 1,
+    BSGamma = 1u << 2,
+    BSVega = 1u << 3,
+    BSTheta = 1u << 4,
+    BSRho = 1u << 5,
+    BSGreeks = BSDelta | BSGamma | BSVega | BSTheta | BSRho,
+    BSAll = BSPrice | BSGreeks
+};
+
+template <typename T>
+struct BasicBSResult {
+    T price{0.0};
+    T delta{0.0};
+    T gamma{0.0};
+    T vega{0.0};
+    T theta{0.0};
+    T rho{0.0};
+    T d1{0.0};
+    T d2{0.0};
+    T df{1.0}; // exp(-rT)
+    T qf{1.0}; // exp(-qT)
+};
+using BSResult = BasicBSResult<double>;
+
+// One-pass Black-Scholes price and Greeks with continuous dividend yield q.
+// Expired options and non-positive vols return a zeroed result. T is float, double or any scalar
+// with their arithmetic and exp/log/sqrt/norm_cdf/norm_pdf overloads (core::Real, core::Dual).
+template <unsigned Outputs = BSAll, typename T = double>
+inline BasicBSResult<T> black_scholes(quant::instruments::OptionType type, T S, T K, T maturity, T r, T q, T vol) {
+    using quant::core::norm_cdf;
+    using quant::core::norm_pdf;
+    using std::exp;
+    using std::log;
+    using std::sqrt;
+    using Scalar = quant::core::scalar_t<T>;
+    constexpr bool need_df = (Outputs & (BSPrice | BSTheta | BSRho)) != 0;
+    constexpr bool need_nd1 = (Outputs & (BSPrice | BSDelta | BSTheta)) != 0;
+    constexpr bool need_nd2 = (Outputs & (BSPrice | BSTheta | BSRho)) != 0;
+    constexpr bool need_pdf = (Outputs & (BSGamma | BSVega | BSTheta)) != 0;
+
+    BasicBSResult<T> res;
+    if (maturity <= Scalar(0) || vol <= Scalar(0)) return res;
+    const Scalar phi = type == quant::instruments::OptionType::Call ? Scalar(1) : Scalar(-1);
+    T sqrtT = sqrt(maturity);
+    T sd = vol * sqrtT;
+    res.d1 = (log(S / K) + (r - q + Scalar(0.5) * vol * vol) * maturity) / sd;
+    res.d2 = res.d1 - sd;
+    res.qf = exp(-q * maturity);
+    if constexpr (need_df) res.df = exp(-r * maturity);
+
+    T nd1(Scalar(0));
+    T kd(Scalar(0)); // K e^{-rT} N(phi d2)
+    T pdf(Scalar(0));
+    if constexpr (need_nd1) nd1 = norm_cdf(phi * res.d1);
+    if constexpr (need_nd2) kd = K * res.df * norm_cdf(phi * res.d2);
+    if constexpr (need_pdf) pdf = norm_pdf(res.d1);
+
+    T sq = S * res.qf * nd1; // S e^{-qT} N(phi d1)
+    if constexpr ((Outputs & BSPrice) != 0) res.price = phi * (sq - kd);
+    if constexpr ((Outputs & BSDelta) != 0) res.delta = phi * res.qf * nd1;
+    if constexpr ((Outputs & BSGamma) != 0) res.gamma = res.qf * pdf / (S * sd);
+    if constexpr ((Outputs & BSVega) != 0) res.vega = S * res.qf * pdf * sqrtT;
+    if constexpr ((Outputs & BSTheta) != 0) {
+        res.theta = -(S * res.qf * pdf * vol) / (Scalar(2) * sqrtT) + phi * (q * sq - r * kd);
+    }
+    if constexpr ((Outputs & BSRho) != 0) res.rho = phi * maturity * kd;
+    return res;
+}
+
+} // namespace quant::pricing
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "quant/core/Exceptions.hpp"
+#include "quant/instruments/BarrierOption.hpp"
+#include "quant/instruments/EuropeanOption.hpp"
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/pricing/BarrierOption.hpp"
+#include "quant/pricing/BlackScholesBatch.hpp"
+
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace quant::pricing {
+
+// Contiguous storage for one instrument type of a book.
+template <typename T>
+class BookGroup {
+public:
+    void reserve(std::size_t n) { items_.reserve(n); }
+    void add(const T& inst) { items_.push_back(inst); }
+    std::size_t size() const { return items_.size(); }
+    std::span<const T> items() const { return items_; }
+
+private:
+    std::vector<T> items_;
+};
+
+// European options are kept as a structure-of-arrays chain so the group feeds the batch engine as is.
+// An option's attached yield curve and vol surface are resolved to r and sigma when it is added,
+// so values match EuropeanOption::npv for the market data at that time.
+template <>
+class BookGroup<quant::instruments::EuropeanOption> {
+public:
+    void reserve(std::size_t n) { chain_.reserve(n); }
+    void add(const quant::instruments::EuropeanOption& opt) { chain_.push_back(opt); }
+    std::size_t size() const { return chain_.size(); }
+    OptionChainView chain() const { return chain_.view(); }
+
+private:
+    OptionChain chain_;
+};
+
+// A book of instruments grouped by concrete type, one BookGroup per type of the list. Values
+// are laid out group by group in list order, insertion order within a group.
+template <typename... Instruments>
+class BasicBook {
+public:
+    using value_type = std::variant<Instruments...>;
+
+    template <typename T>
+    void add(const T& inst) {
+        std::get<BookGroup<T>>(groups_).add(inst);
+    }
+    void add(const value_type& inst) {
+        std::visit([this](const auto& i) { add(i); }, inst);
+    }
+
+    template <typename T>
+    BookGroup<T>& group() {
+        return std::get<BookGroup<T>>(groups_);
+    }
+    template <typename T>
+    const BookGroup<T>& group() const {
+        return std::get<BookGroup<T>>(groups_);
+    }
+
+    // Position of the first value of group T.
+    template <typename T>
+    std::size_t offset() const {
+        std::size_t offset = 0;
+        bool before = true;
+        ((before = before && !std::is_same_v<T, Instruments>,
+          offset += before ? group<Instruments>().size() : 0),
+         ...);
+        return offset;
+    }
+
+    std::size_t size() const { return (group<Instruments>().size() + ... + 0); }
+
+    template <typename Fn>
+    void for_each_group(Fn&& fn) const {
+        std::apply([&](const auto&... g) { (fn(g), ...); }, groups_);
+    }
+
+private:
+    std::tuple<BookGroup<Instruments>...> groups_;
+};
+
+using Book = BasicBook<quant::instruments::EuropeanOption, quant::instruments::BarrierOption,
+                       quant::instruments::VanillaSwap>;
+
+// Prices a book group by group, each through its engine's concrete entry point; the overload for
+// each group is picked at compile time, so the loop has no casts or virtual calls. A book holding
+// a type without a price(const BookGroup<T>&, ...) overload does not compile.
+class BookPricer {
+public:
+    explicit BookPricer(std::size_t threads = 0, AnalyticBarrierEngine barrier = AnalyticBarrierEngine())
+        : threads_(threads), european_(threads), barrier_(barrier) {}
+
+    template <typename... Instruments>
+    void price(const BasicBook<Instruments...>& book, std::span<double> values) const {
+        if (values.size() != book.size()) throw quant::core::PricingError("Book value array size mismatch");
+        std::size_t offset = 0;
+        book.for_each_group([&](const auto& g) {
+            price(g, values.subspan(offset, g.size()));
+            offset += g.size();
+        });
+    }
+
+    template <typename... Instruments>
+    double total(const BasicBook<Instruments...>& book) const {
+        std::vector<double> values(book.size());
+        price(book, values);
+        return std::accumulate(values.begin(), values.end(), 0.0);
+    }
+
+    void price(const BookGroup<quant::instruments::EuropeanOption>& group, std::span<double> values) const;
+    void price(const BookGroup<quant::instruments::BarrierOption>& group, std::span<double> values) const;
+    void price(const BookGroup<quant::instruments::VanillaSwap>& group, std::span<double> values) const;
+
+private:
+    std::size_t threads_;
+    BlackScholesBatchEngine european_;
+    AnalyticBarrierEngine barrier_;
+};
+
+} // namespace quant::pricing
@@ -10,6 +10,11 @@ class DiscountingSwapEngine : public PricingEngine {
 public:
     double price(const quant::instruments::Instrument& inst) const override;
     double price(const quant::instruments::VanillaSwap& swap) const;
+    // Value on the given curve, e.g. a shocked view, instead of the swap's own.
+    template <quant::market::DiscountCurve Curve>
+    double price(const quant::instruments::VanillaSwap& swap, const Curve& curve) const {
+        return swap.npv(curve);
+    }
 };
 
 } // namespace quant::pricing
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace quant::pricing {
+
+// Bermudan exercise is allowed on a number of equally spaced dates, the last one at maturity.
+enum class ExerciseStyle { European, American, Bermudan };
+
+} // namespace quant::pricing
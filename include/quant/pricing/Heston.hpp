@@ -0,0 +1,88 @@
+#pragma once
+
+#include "quant/instruments/EuropeanOption.hpp"
+#include "quant/market/VolSurface.hpp"
+#include "quant/pricing/PricingEngine.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace quant::pricing {
+
+// dS = (r - q) S dt + sqrt(v) S dW1, dv = kappa (theta - v) dt + sigma sqrt(v) dW2, d<W1, W2> = rho dt.
+class HestonModel {
+public:
+    HestonModel(double v0, double kappa, double theta, double sigma, double rho);
+
+    // E[exp(i u ln(S_T / F_T))] in the branch-cut-free form of Albrecher et al. ("The little Heston trap").
+    std::complex<double> characteristic_function(std::complex<double> u, double maturity) const;
+
+    double v0() const { return v0_; }
+    double kappa() const { return kappa_; }
+    double theta() const { return theta_; }
+    double sigma() const { return sigma_; }
+    double rho() const { return rho_; }
+
+private:
+    double v0_;
+    double kappa_;
+    double theta_;
+    double sigma_;
+    double rho_;
+};
+
+struct HestonSettings {
+    std::size_t cos_terms{256};       // Fang-Oosterlee COS expansion length for strips
+    double truncation{10.0};          // COS interval half-width L in sqrt(c2 + sqrt(c4)) of ln(S_T / F)
+    std::size_t quadrature_panels{16}; // 16-point Gauss-Legendre panels for the single-option integral
+};
+
+// Single options use Lewis' integral over the characteristic function; price_strip prices every
+// strike of one expiry from a single COS expansion of the density. Characteristic-function values
+// depend only on the maturity and are cached per maturity, shared between copies of the engine.
+class HestonEngine : public PricingEngine {
+public:
+    explicit HestonEngine(HestonModel model, HestonSettings settings = {});
+
+    double price(const quant::instruments::Instrument& inst) const override;
+    double price(const quant::instruments::EuropeanOption& opt) const;
+
+    void price_strip(quant::instruments::OptionType type, double spot, double maturity, double rate, double dividend,
+                     std::span<const double> strikes, std::span<double> prices) const;
+
+    const HestonModel& model() const { return model_; }
+    const HestonSettings& settings() const { return settings_; }
+
+private:
+    struct Cache;
+
+    HestonModel model_;
+    HestonSettings settings_;
+    std::shared_ptr<Cache> cache_;
+};
+
+struct HestonCalibrationSettings {
+    std::optional<HestonModel> initial; // default: v0 = theta = ATM variance, kappa 1.5, sigma 0.5, rho -0.5
+    std::size_t max_iterations{100};
+    double tolerance{1e-10};
+    HestonSettings pricing{};
+    std::size_t threads{0};
+};
+
+struct HestonCalibration {
+    HestonModel model{0.04, 1.0, 0.04, 0.5, 0.0};
+    double rmse{0.0}; // vega-weighted price error, approximately in vol units
+    std::size_t iterations{0};
+    bool converged{false};
+};
+
+// Levenberg-Marquardt fit to the out-of-the-money prices implied by every surface node with a
+// positive strike and tenor; residuals are price errors over Black-Scholes vega. Each expiry is
+// one COS strip, and the expiries of every residual and Jacobian evaluation run in parallel.
+HestonCalibration calibrate_heston(const quant::market::VolSurface& surface, double spot, double rate,
+                                   double dividend = 0.0, const HestonCalibrationSettings& settings = {});
+
+} // namespace quant::pricing
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "quant/instruments/EuropeanOption.hpp"
+#include "quant/market/VolSurface.hpp"
+#include "quant/pricing/BlackScholesBatch.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace quant::pricing {
+
+// Black-Scholes implied volatility in the style of Jaeckel's "Let's Be Rational": prices are
+// reduced to a normalised out-of-the-money call, a rational branch-specific initial guess is
+// refined by third-order Householder steps on a branch-specific objective.
+// Prices outside the no-arbitrage bounds give NaN.
+class ImpliedVolSolver {
+public:
+    explicit ImpliedVolSolver(double tolerance = 1e-12, std::size_t max_iterations = 16, std::size_t threads = 0)
+        : tolerance_(tolerance), max_iterations_(max_iterations), threads_(threads) {}
+
+    double solve(quant::instruments::OptionType type, double price, double spot, double strike, double maturity,
+                 double rate, double dividend = 0.0) const;
+    double solve(const quant::instruments::EuropeanOption& opt, double price) const;
+
+    // Inverts a whole chain in parallel; chain.vol is ignored.
+    void solve(const OptionChainView& chain, std::span<const double> prices, std::span<double> vols) const;
+
+private:
+    double tolerance_;
+    std::size_t max_iterations_;
+    std::size_t threads_;
+};
+
+// Builds a surface from a strike x tenor grid of quoted prices, prices[i][j] for strike i and tenor j.
+quant::market::VolSurface implied_vol_surface(std::vector<double> strikes, std::vector<double> tenors,
+                                              const std::vector<std::vector<double>>& prices,
+                                              quant::instruments::OptionType type, double spot, double rate,
+                                              double dividend = 0.0,
+                                              const ImpliedVolSolver& solver = ImpliedVolSolver());
+
+} // namespace quant::pricing
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "quant/instruments/BarrierOption.hpp"
+#include "quant/instruments/EuropeanOption.hpp"
+#include "quant/pricing/Exercise.hpp"
+#include "quant/pricing/PricingEngine.hpp"
+
+#include <cstddef>
+
+namespace quant::pricing {
+
+enum class LatticeType { Binomial, Trinomial };
+
+struct LatticeSettings {
+    LatticeType type{LatticeType::Trinomial};
+    std::size_t steps{200};
+    ExerciseStyle exercise{ExerciseStyle::European};
+    std::size_t exercise_dates{12};
+    bool smoothing{true};   // closed-form values on the last step instead of the kinked payoff
+    bool richardson{false}; // extrapolate the 1/N error from steps and steps / 2; pays off for early exercise
+};
+
+// Recombining lattice in log spot. Node spot prices come from one precomputed geometric ladder and
+// values are rolled back in a single in-place buffer. For barriers the node spacing is chosen so
+// that a layer of nodes sits on the barrier: the trinomial stretches its space step (Ritchken),
+// the binomial picks the nearby step count that puts a layer just beyond it (Boyle-Lau), and the
+// step count is raised if the barrier is too close to spot for any node to fit in between. Step
+// counts stay within 8x steps: a barrier closer still is priced on the requested steps by
+// interpolating between the values with the barrier on the layers either side of it.
+// Knock-ins are priced by parity on the same lattice and support European exercise only.
+class LatticeEngine : public PricingEngine {
+public:
+    explicit LatticeEngine(LatticeSettings settings = {}) : settings_(settings) {}
+
+    double price(const quant::instruments::Instrument& inst) const override;
+    double price(const quant::instruments::EuropeanOption& opt) const;
+    double price(const quant::instruments::BarrierOption& opt) const;
+
+    const LatticeSettings& settings() const { return settings_; }
+
+private:
+    LatticeSettings settings_;
+};
+
+} // namespace quant::pricing
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "quant/instruments/BarrierOption.hpp"
+#include "quant/instruments/EuropeanOption.hpp"
+#include "quant/pricing/PricingEngine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace quant::pricing {
+
+// Discrete checks the barrier on the simulation grid only; Continuous adds the Brownian-bridge
+// probability of crossing between grid points.
+enum class BarrierMonitoring { Discrete, Continuous };
+
+// Source of the Gaussian draws. Sobol uses a scrambled sequence (keyed by the seed) with one
+// dimension per time step in time order; SobolBrownianBridge feeds it through a Brownian bridge
+// so the leading dimensions carry the terminal value and coarse path shape. Steps beyond
+// SobolSequence::max_dimension() are filled with Philox normals. For the Sobol generators
+// std_error is the i.i.d. estimate and overstates the error; replicate over seeds instead.
+enum class PathGenerator { PseudoRandom, Sobol, SobolBrownianBridge };
+
+struct MonteCarloSettings {
+    std::size_t paths{100000};
+    std::size_t steps{100}; // time steps for barrier paths; European options are simulated in one exact step
+    std::uint64_t seed{42};
+    bool antithetic{true};
+    bool control_variate{true};
+    BarrierMonitoring monitoring{BarrierMonitoring::Continuous};
+    PathGenerator generator{PathGenerator::PseudoRandom};
+    std::size_t threads{0};
+};
+
+struct MonteCarloResult {
+    double price{0.0};
+    double std_error{0.0};
+    std::size_t paths{0};
+};
+
+// Geometric Brownian motion Monte Carlo. Paths are simulated in fixed-size structure-of-arrays
+// blocks whose random numbers come from a Philox stream or Sobol point per path, both addressable
+// by path index, and block sums are reduced in block order, so results are bit-identical for any
+// thread count. The control variate is the
+// Black-Scholes vanilla for barriers and the discounted terminal spot for European options.
+class MonteCarloEngine : public PricingEngine {
+public:
+    explicit MonteCarloEngine(MonteCarloSettings settings = {}) : settings_(settings) {}
+
+    double price(const quant::instruments::Instrument& inst) const override;
+    double price(const quant::instruments::EuropeanOption& opt) const;
+    double price(const quant::instruments::BarrierOption& opt) const;
+
+    MonteCarloResult simulate(const quant::instruments::EuropeanOption& opt) const;
+    MonteCarloResult simulate(const quant::instruments::BarrierOption& opt) const;
+
+    const MonteCarloSettings& settings() const { return settings_; }
+
+private:
+    MonteCarloSettings settings_;
+};
+
+} // namespace quant::pricing
@@ -3,14 +3,30 @@
 #include "quant/instruments/EuropeanOption.hpp"
 #include "quant/pricing/PricingEngine.hpp"
 
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
 namespace quant::pricing {
 
+// Hagan et al. lognormal SABR expansion; the double instance of the sabr_vol kernel.
 class SABRModel {
 public:
     SABRModel(double alpha, double beta, double rho, double nu)
         : alpha_(alpha), beta_(beta), rho_(rho), nu_(nu) {}
 
     double implied_vol(double forward, double strike, double maturity) const;
+    // Also returns d vol / d (alpha, beta, rho, nu).
+    double implied_vol(double forward, double strike, double maturity, std::array<double, 4>& gradient) const;
+    // Whole strike strip for one forward and expiry, vectorised across strikes with the
+    // parameter and forward terms computed once.
+    void implied_vols(double forward, double maturity, std::span<const double> strikes, std::span<double> vols) const;
+
+    double alpha() const { return alpha_; }
+    double beta() const { return beta_; }
+    double rho() const { return rho_; }
+    double nu() const { return nu_; }
 
 private:
     double alpha_;
@@ -27,10 +43,41 @@ public:
     double price(const quant::instruments::Instrument& inst) const override;
     double price(const quant::instruments::EuropeanOption& opt) const;
 
+    const SABRModel& model() const { return model_; }
+
 private:
     SABRModel model_;
     double discount_rate_;
 };
 
-} // namespace quant::pricing
+// One expiry slice of market implied vols; empty weights mean equal weights.
+struct SABRSmile {
+    double forward{0.0};
+    double maturity{0.0};
+    std::vector<double> strikes;
+    std::vector<double> vols;
+    std::vector<double> weights;
+};
 
+struct SABRCalibrationSettings {
+    double beta{0.5};             // fixed beta, or the starting point when calibrate_beta is set
+    bool calibrate_beta{false};   // beta and rho are nearly collinear on a single smile
+    std::size_t max_iterations{50};
+    double tolerance{1e-12};
+    std::size_t threads{0};
+};
+
+struct SABRCalibration {
+    SABRModel model{0.0, 0.0, 0.0, 0.0};
+    double rmse{0.0}; // weighted root-mean-square vol error
+    std::size_t iterations{0};
+    bool converged{false};
+};
+
+// Levenberg-Marquardt fit with the analytic Jacobian, in transformed parameters that keep
+// alpha, nu > 0, |rho| < 1 and 0 <= beta <= 1. Slices are calibrated in parallel.
+SABRCalibration calibrate_sabr(const SABRSmile& smile, const SABRCalibrationSettings& settings = {});
+std::vector<SABRCalibration> calibrate_sabr(std::span<const SABRSmile> smiles,
+                                            const SABRCalibrationSettings& settings = {});
+
+} // namespace quant::pricing
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "quant/core/Math.hpp"
+
+#include <array>
+#include <cmath>
+
+namespace quant::pricing {
+
+// Parameter and forward terms shared by every strike of one smile. With b = 1 - beta,
+// A = (F K)^(b / 2) and L = ln(F / K):
+//   vol = alpha / (A D) * z / x(z) * (1 + C T),  z = nu / alpha * A * L,
+//   D = 1 + b^2 L^2 / 24 + b^4 L^4 / 1920,
+//   C = b^2 alpha^2 / (24 A^2) + rho beta nu alpha / (4 A) + (2 - 3 rho^2) nu^2 / 24.
+template <typename T>
+struct SABRSmileTerms {
+    T alpha, beta, rho, nu, maturity;
+    T log_f, b;
+    T d2, d4;         // b^2 / 24, b^4 / 1920
+    T z_scale;        // nu / alpha
+    T c_a, c_rb, c_n; // b^2 alpha^2 / 24, rho beta nu alpha / 4, (2 - 3 rho^2) nu^2 / 24
+    T small_2;        // (2 - 3 rho^2) / 12
+};
+
+template <typename T>
+SABRSmileTerms<T> sabr_smile_terms(T alpha, T beta, T rho, T nu, T forward, T maturity) {
+    using std::log;
+    using Scalar = quant::core::scalar_t<T>;
+    T b = Scalar(1) - beta;
+    return {alpha,
+            beta,
+            rho,
+            nu,
+            maturity,
+            log(forward),
+            b,
+            b * b / Scalar(24),
+            b * b * b * b / Scalar(1920),
+            nu / alpha,
+            b * b * alpha * alpha / Scalar(24),
+            Scalar(0.25) * rho * beta * nu * alpha,
+            (Scalar(2) - Scalar(3) * rho * rho) * nu * nu / Scalar(24),
+            (Scalar(2) - Scalar(3) * rho * rho) / Scalar(12)};
+}
+
+// Hagan et al. lognormal vol at one strike; fills d vol / d (alpha, beta, rho, nu) when gradient
+// is not null. Below |z| = eps^(1/4) of the scalar type z / x(z) uses its quadratic expansion,
+// balancing the truncation error against cancellation in x(z).
+template <typename T>
+T sabr_vol(const SABRSmileTerms<T>& t, T strike, std::array<T, 4>* gradient = nullptr) {
+    using std::exp;
+    using std::fabs;
+    using std::log;
+    using std::sqrt;
+    using Scalar = quant::core::scalar_t<T>;
+    constexpr Scalar small_z = sizeof(Scalar) < sizeof(double) ? Scalar(2e-2) : Scalar(1e-4);
+    const Scalar one(1), half(0.5);
+
+    T log_k = log(strike);
+    T L = t.log_f - log_k;
+    T P = half * (t.log_f + log_k);
+    T A = exp(t.b * P);
+    T z = t.z_scale * A * L;
+    T R, R_z, R_rho;
+    if (fabs(z) < small_z) {
+        R = one - half * t.rho * z + t.small_2 * z * z;
+        R_z = -half * t.rho + Scalar(2) * t.small_2 * z;
+        R_rho = -half * z - half * t.rho * z * z;
+    } else {
+        T s = sqrt(one - Scalar(2) * t.rho * z + z * z);
+        T x = log((s + z - t.rho) / (one - t.rho));
+        R = z / x;
+        R_z = (x - z / s) / (x * x);
+        T x_rho = (-z / s - one) / (s + z - t.rho) + one / (one - t.rho);
+        R_rho = -z * x_rho / (x * x);
+    }
+    T L2 = L * L;
+    T D = one + t.d2 * L2 + t.d4 * L2 * L2;
+    T C = t.c_a / (A * A) + t.c_rb / A + t.c_n;
+    T G = one + C * t.maturity;
+    T vol = t.alpha / (A * D) * R * G;
+    if (!gradient) return vol;
+
+    // d ln(vol) = d ln(alpha / (A D)) + dR / R + T dC / G, with dA / dbeta = -P A.
+    const T &a = t.alpha, &b = t.b, &nu = t.nu, &rho = t.rho, &beta = t.beta;
+    T z_alpha = -z / a, z_beta = -P * z, z_nu = A * L / a;
+    T D_beta = -(b * L2 / Scalar(12) + b * b * b * L2 * L2 / Scalar(480));
+    T C_alpha = b * b * a / (Scalar(12) * A * A) + Scalar(0.25) * rho * beta * nu / A;
+    T C_beta = a * a * (b * b * P - b) / (Scalar(12) * A * A) + Scalar(0.25) * rho * nu * a * (one + beta * P) / A;
+    T C_rho = Scalar(0.25) * beta * nu * a / A - Scalar(0.25) * rho * nu * nu;
+    T C_nu = Scalar(0.25) * rho * beta * a / A + (Scalar(2) - Scalar(3) * rho * rho) * nu / Scalar(12);
+    T tg = t.maturity / G;
+    (*gradient)[0] = vol * (one / a + R_z * z_alpha / R + tg * C_alpha);
+    (*gradient)[1] = vol * (P - D_beta / D + R_z * z_beta / R + tg * C_beta);
+    (*gradient)[2] = vol * (R_rho / R + tg * C_rho);
+    (*gradient)[3] = vol * (R_z * z_nu / R + tg * C_nu);
+    return vol;
+}
+
+// Single-strike SABR implied vol; zero for non-positive forwards or strikes.
+template <typename T>
+T sabr_implied_vol(T alpha, T beta, T rho, T nu, T forward, T strike, T maturity) {
+    using Scalar = quant::core::scalar_t<T>;
+    if (forward <= Scalar(0) || strike <= Scalar(0)) return T(Scalar(0));
+    return sabr_vol(sabr_smile_terms(alpha, beta, rho, nu, forward, maturity), strike);
+}
+
+} // namespace quant::pricing
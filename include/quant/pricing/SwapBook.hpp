@@ -0,0 +1,77 @@
+#pragma once
+
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/YieldCurve.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace quant::pricing {
+
+// Structure-of-arrays swap book. Every cashflow indexes a grid of the distinct payment and fixing
+// times of its discount curve, so a time shared by many trades is evaluated once per curve. Curves
+// are held by pointer and read when the book is priced.
+class SwapBook {
+public:
+    void reserve(std::size_t swaps, std::size_t cashflows = 0);
+    // On the swap's discount curve, or on the given one.
+    void push_back(const quant::instruments::VanillaSwap& swap);
+    void push_back(const quant::instruments::VanillaSwap& swap, const quant::market::YieldCurve& curve);
+
+    std::size_t size() const { return notional_.size(); }
+    std::size_t curves() const { return curves_.size(); }
+    std::size_t cashflows() const { return fixed_accrual_.size() + float_end_.size(); }
+    std::size_t grid_size() const { return grid_time_.size(); }
+
+private:
+    friend class SwapBookEngine;
+
+    struct Curve {
+        const quant::market::YieldCurve* curve;
+        std::vector<std::uint32_t> points; // grid indices of this curve's times
+        std::unordered_map<double, std::uint32_t> index;
+    };
+    std::uint32_t grid_point(Curve& curve, double t);
+
+    // Per swap; the cashflows of swap i are [fixed_begin_[i], fixed_begin_[i + 1]) and likewise
+    // for the float periods, whose start boundaries are float_start_.
+    std::vector<double> notional_, fixed_rate_, spread_, sign_;
+    std::vector<std::uint32_t> fixed_begin_{0}, float_begin_{0};
+    // Per cashflow; a float period accrues between its boundary times.
+    std::vector<double> fixed_accrual_;
+    std::vector<std::uint32_t> fixed_point_;
+    std::vector<std::uint32_t> float_start_, float_end_;
+    // Shared grid over all curves.
+    std::vector<double> grid_time_;
+    std::vector<Curve> curves_;
+    std::unordered_map<const quant::market::YieldCurve*, std::uint32_t> curve_index_;
+};
+
+// Per-swap outputs in insertion order; empty spans are skipped. The annuity is per unit notional,
+// as VanillaSwap::annuity; a swap without fixed cashflows gets a NaN fair rate.
+struct SwapBookOutput {
+    std::span<double> npv;
+    std::span<double> fair_rate;
+    std::span<double> annuity;
+};
+
+// Values a SwapBook on the current state of its curves: -ln P and the discount factor at every
+// grid time, then the leg sums of each swap, both split across threads (0 = all hardware
+// threads). Agrees with VanillaSwap::npv/fair_rate/annuity to rounding.
+class SwapBookEngine {
+public:
+    explicit SwapBookEngine(std::size_t threads = 0, std::size_t min_block = 4096)
+        : threads_(threads), min_block_(min_block) {}
+
+    void price(const SwapBook& book, std::span<double> npv) const;
+    void price(const SwapBook& book, const SwapBookOutput& out) const;
+
+private:
+    std::size_t threads_;
+    std::size_t min_block_;
+};
+
+} // namespace quant::pricing
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "quant/instruments/EuropeanOption.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
 
 namespace quant::risk {
 
+quant::pricing::BSResult black_scholes_greeks(const quant::instruments::EuropeanOption& opt);
 double black_scholes_price(const quant::instruments::EuropeanOption& opt);
 double black_scholes_delta(const quant::instruments::EuropeanOption& opt);
 double black_scholes_gamma(const quant::instruments::EuropeanOption& opt);
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/YieldCurve.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace quant::risk {
+
+// Zero-rate risk per basis point: key_rate[k] is the change in value when the zero rate of pillar
+// k of YieldCurve::times() rises 1bp, dv01 the change under a parallel 1bp rise (their sum).
+struct RateRisk {
+    double npv{0.0};
+    double dv01{0.0};
+    std::vector<double> key_rate;
+};
+
+// One pass over the swap's cashflow table. On linear-zero and log-linear curves every discount
+// factor depends on at most two pillars (YieldCurve::pillar_weights), so the key rates are
+// accumulated analytically; on monotone convex curves the discount exponents are recorded on a tape
+// and the pillar sensitivities come from one adjoint sweep per batch of swaps.
+RateRisk swap_rate_risk(const quant::instruments::VanillaSwap& swap);
+RateRisk swap_rate_risk(const quant::instruments::VanillaSwap& swap, const quant::market::YieldCurve& curve);
+
+// Totals over a book valued on one curve, swaps split across threads (0 = all hardware threads).
+RateRisk book_rate_risk(std::span<const quant::instruments::VanillaSwap> swaps, const quant::market::YieldCurve& curve,
+                        std::size_t threads = 0);
+
+} // namespace quant::risk
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "quant/instruments/Instrument.hpp"
+#include "quant/market/Fwd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace quant::risk {
+
+struct RevaluationStats {
+    std::size_t touched{0}; // instruments repriced
+    std::size_t total{0};   // instruments in the graph
+    double seconds{0.0};
+};
+
+// Cached NPVs of a book with an edge from every curve and surface to the instruments that read
+// it. When a market object changes in place (e.g. YieldCurve::set_zero_rates), invalidate() it;
+// revalue() then reprices only the instruments depending on invalidated objects, over up to
+// `threads` threads (0: all hardware threads). Market objects are keyed by address, so one
+// must not be replaced by another at the same address without invalidating it.
+class RevaluationGraph {
+public:
+    explicit RevaluationGraph(std::size_t threads = 1) : threads_(threads) {}
+
+    // Dependencies are read from the curve/surface pointers of VanillaSwap and EuropeanOption;
+    // the second form lists them explicitly. New instruments are priced by the next revalue().
+    std::size_t add(std::shared_ptr<const quant::instruments::Instrument> inst);
+    std::size_t add(std::shared_ptr<const quant::instruments::Instrument> inst,
+                    const std::vector<const quant::market::YieldCurve*>& curves,
+                    const std::vector<const quant::market::VolSurface*>& surfaces);
+
+    void invalidate(const quant::market::YieldCurve& curve) { invalidate(static_cast<const void*>(&curve)); }
+    void invalidate(const quant::market::VolSurface& surface) { invalidate(static_cast<const void*>(&surface)); }
+    void invalidate_all();
+    RevaluationStats revalue();
+
+    double npv(std::size_t index) const { return npv_.at(index); }
+    double total() const; // sum of the cached NPVs
+    std::size_t size() const { return instruments_.size(); }
+    std::size_t dependents(const quant::market::YieldCurve& curve) const { return dependents(&curve); }
+    std::size_t dependents(const quant::market::VolSurface& surface) const { return dependents(&surface); }
+    const RevaluationStats& last() const { return last_; }
+
+private:
+    std::size_t add(std::shared_ptr<const quant::instruments::Instrument> inst, const std::vector<const void*>& deps);
+    void invalidate(const void* object);
+    void mark(std::uint32_t index);
+    std::size_t dependents(const void* object) const;
+
+    std::size_t threads_;
+    std::vector<std::shared_ptr<const quant::instruments::Instrument>> instruments_;
+    std::vector<double> npv_;
+    std::vector<std::uint8_t> dirty_;
+    std::vector<std::uint32_t> dirty_list_;
+    std::unordered_map<const void*, std::vector<std::uint32_t>> dependents_;
+    RevaluationStats last_;
+};
+
+} // namespace quant::risk
@@ -3,6 +3,7 @@
 #include "quant/instruments/Instrument.hpp"
 #include "quant/pricing/PricingEngine.hpp"
 #include "quant/market/YieldCurve.hpp"
+#include "quant/market/Views.hpp"
 #include "quant/market/VolSurface.hpp"
 
 #include <memory>
@@ -12,10 +13,15 @@ namespace quant::risk {
 
 struct ScenarioShock {
     double rate_parallel_bp{0.0};
-    double vol_shift{0.0};
-    double spot_shift{0.0};
+    double vol_shift{0.0};  // relative
+    double spot_shift{0.0}; // relative
+    quant::market::CurveShift curve_shift{}; // twist and bucket shifts, on top of the parallel one
 };
 
+// Revalues a portfolio under a shock by reading the market through ShiftedYieldCurve and
+// ScaledVolSurface views, so no curve, surface or instrument is copied. Swaps are valued on the
+// scenario curve; options on the engine's curve, else the scenario curve, else their own rate,
+// and on the scenario surface, else their own vol.
 class ScenarioEngine {
 public:
     ScenarioEngine(const quant::pricing::PricingEngine& engine,
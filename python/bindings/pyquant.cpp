@@ -13,6 +13,7 @@
 #include "quant/instruments/VanillaSwap.hpp"
 #include "quant/pricing/BlackScholes.hpp"
 #include "quant/pricing/BarrierOption.hpp"
+#include "quant/pricing/Heston.hpp"
 #include "quant/pricing/SABR.hpp"
 #include "quant/backtest/Backtester.hpp"
 #include "quant/utils/Volatility.hpp"
@@ -83,14 +84,48 @@ PYBIND11_MODULE(pyquant, m) {
         .def(py::init<std::size_t>(), py::arg("steps") = 200)
         .def("price", py::overload_cast<const instruments::BarrierOption&>(&pricing::BarrierOptionEngine::price, py::const_));
 
+    py::class_<pricing::AnalyticBarrierEngine>(m, "AnalyticBarrierEngine")
+        .def(py::init<std::size_t>(), py::arg("monitoring_points") = 0)
+        .def("price", py::overload_cast<const instruments::BarrierOption&>(&pricing::AnalyticBarrierEngine::price, py::const_));
+
+    py::enum_<market::CurveInterpolation>(m, "CurveInterpolation")
+        .value("LinearZero", market::CurveInterpolation::LinearZero)
+        .value("LogLinearDiscount", market::CurveInterpolation::LogLinearDiscount)
+        .value("MonotoneConvex", market::CurveInterpolation::MonotoneConvex);
+
     py::class_<market::YieldCurve>(m, "YieldCurve")
-        .def(py::init<std::vector<double>, std::vector<double>>())
-        .def("discount", &market::YieldCurve::discount)
-        .def("zero_rate", &market::YieldCurve::zero_rate);
+        .def(py::init<std::vector<double>, std::vector<double>, market::CurveInterpolation>(), py::arg("times"),
+             py::arg("zero_rates"), py::arg("interpolation") = market::CurveInterpolation::LinearZero)
+        .def("discount", py::overload_cast<double>(&market::YieldCurve::discount, py::const_))
+        .def("zero_rate", py::overload_cast<double>(&market::YieldCurve::zero_rate, py::const_))
+        .def("forward_rate", &market::YieldCurve::forward_rate);
 
     py::class_<pricing::SABRModel>(m, "SABRModel")
         .def(py::init<double, double, double, double>())
-        .def("implied_vol", &pricing::SABRModel::implied_vol);
+        .def("implied_vol", py::overload_cast<double, double, double>(&pricing::SABRModel::implied_vol, py::const_))
+        .def_property_readonly("alpha", &pricing::SABRModel::alpha)
+        .def_property_readonly("beta", &pricing::SABRModel::beta)
+        .def_property_readonly("rho", &pricing::SABRModel::rho)
+        .def_property_readonly("nu", &pricing::SABRModel::nu);
+
+    py::class_<pricing::HestonModel>(m, "HestonModel")
+        .def(py::init<double, double, double, double, double>(), py::arg("v0"), py::arg("kappa"), py::arg("theta"),
+             py::arg("sigma"), py::arg("rho"))
+        .def_property_readonly("v0", &pricing::HestonModel::v0)
+        .def_property_readonly("kappa", &pricing::HestonModel::kappa)
+        .def_property_readonly("theta", &pricing::HestonModel::theta)
+        .def_property_readonly("sigma", &pricing::HestonModel::sigma)
+        .def_property_readonly("rho", &pricing::HestonModel::rho);
+
+    py::class_<pricing::HestonEngine>(m, "HestonEngine")
+        .def(py::init<pricing::HestonModel>())
+        .def("price", py::overload_cast<const instruments::EuropeanOption&>(&pricing::HestonEngine::price, py::const_))
+        .def("price_strip", [](const pricing::HestonEngine& e, instruments::OptionType type, double spot,
+                               double maturity, double rate, double dividend, const std::vector<double>& strikes) {
+            std::vector<double> prices(strikes.size());
+            e.price_strip(type, spot, maturity, rate, dividend, strikes, prices);
+            return prices;
+        });
 
     py::class_<pricing::SABREuropeanEngine>(m, "SABREuropeanEngine")
         .def(py::init<pricing::SABRModel, double>())
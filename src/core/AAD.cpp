@@ -0,0 +1,32 @@
+#include "quant/core/AAD.hpp"
+#include "quant/core/Exceptions.hpp"
+
+#include <algorithm>
+
+namespace quant::core {
+
+void Tape::grow() {
+    if (capacity_ + kBlockMask + 1 > npos) throw PricingError("AD tape exceeds 2^32 nodes");
+    blocks_.push_back(std::make_unique<Node[]>(kBlockMask + 1));
+    capacity_ += kBlockMask + 1;
+}
+
+void Tape::propagate(const Real& output) {
+    adjoints_.assign(size_, 0.0);
+    if (!output.active()) return;
+    if (output.index() >= size_) throw PricingError("AD output was recorded after the tape position");
+    adjoints_[output.index()] = 1.0;
+    for (std::size_t i = output.index() + 1; i-- > 0;) {
+        double a = adjoints_[i];
+        if (a == 0.0) continue;
+        const Node& n = blocks_[i >> kBlockBits][i & kBlockMask];
+        adjoints_[n.parent[0]] += n.partial[0] * a;
+        adjoints_[n.parent[1]] += n.partial[1] * a;
+    }
+}
+
+double Tape::adjoint(const Real& x) const {
+    return x.active() && x.index() < adjoints_.size() ? adjoints_[x.index()] : 0.0;
+}
+
+} // namespace quant::core
@@ -0,0 +1,69 @@
+#include "quant/core/BrownianBridge.hpp"
+#include "quant/core/Exceptions.hpp"
+
+#include <cmath>
+
+namespace quant::core {
+
+BrownianBridge::BrownianBridge(std::size_t steps) : times_(steps) {
+    for (std::size_t i = 0; i < steps; ++i) times_[i] = static_cast<double>(i + 1);
+    initialize();
+}
+
+BrownianBridge::BrownianBridge(std::vector<double> times) : times_(std::move(times)) {
+    for (std::size_t i = 0; i < times_.size(); ++i) {
+        if (!(times_[i] > (i == 0 ? 0.0 : times_[i - 1]))) {
+            throw DataError("Brownian bridge times must be positive and strictly increasing");
+        }
+    }
+    initialize();
+}
+
+void BrownianBridge::initialize() {
+    const std::size_t n = times_.size();
+    if (n == 0) throw DataError("Brownian bridge needs at least one time step");
+    bridge_index_.assign(n, 0);
+    left_index_.assign(n, 0);
+    right_index_.assign(n, 0);
+    left_weight_.assign(n, 0.0);
+    right_weight_.assign(n, 0.0);
+    stddev_.assign(n, 0.0);
+
+    // map[i] != 0 once point i has been constructed; the terminal point goes first.
+    std::vector<std::size_t> map(n, 0);
+    map[n - 1] = 1;
+    bridge_index_[0] = n - 1;
+    stddev_[0] = std::sqrt(times_[n - 1]);
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        while (map[j]) ++j;
+        std::size_t k = j;
+        while (!map[k]) ++k;
+        // Points j..k-1 are open, k is built; fill the midpoint l between j - 1 and k.
+        std::size_t l = j + ((k - 1 - j) >> 1);
+        map[l] = i;
+        bridge_index_[i] = l;
+        left_index_[i] = j;
+        right_index_[i] = k;
+        double t_left = j == 0 ? 0.0 : times_[j - 1];
+        double span = times_[k] - t_left;
+        left_weight_[i] = (times_[k] - times_[l]) / span;
+        right_weight_[i] = (times_[l] - t_left) / span;
+        stddev_[i] = std::sqrt((times_[l] - t_left) * (times_[k] - times_[l]) / span);
+        j = k + 1;
+        if (j >= n) j = 0;
+    }
+}
+
+void BrownianBridge::transform(const double* normals, double* increments) const {
+    const std::size_t n = times_.size();
+    increments[n - 1] = stddev_[0] * normals[0];
+    for (std::size_t i = 1; i < n; ++i) {
+        std::size_t j = left_index_[i];
+        std::size_t l = bridge_index_[i];
+        double left = j == 0 ? 0.0 : left_weight_[i] * increments[j - 1];
+        increments[l] = left + right_weight_[i] * increments[right_index_[i]] + stddev_[i] * normals[i];
+    }
+    for (std::size_t i = n - 1; i > 0; --i) increments[i] -= increments[i - 1];
+}
+
+} // namespace quant::core
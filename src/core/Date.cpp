@@ -1,27 +1,19 @@
 #include "quant/core/Date.hpp"
 
-#include <cmath>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
 
 namespace quant::core {
 
-Date::Date(int y, unsigned m, unsigned d) : year_(y), month_(m), day_(d) {}
-
 std::chrono::system_clock::time_point Date::to_time_point() const {
-    std::tm tm{};
-    tm.tm_year = year_ - 1900;
-    tm.tm_mon = static_cast<int>(month_) - 1;
-    tm.tm_mday = static_cast<int>(day_);
-    tm.tm_isdst = -1;
-    std::time_t t = std::mktime(&tm);
-    return std::chrono::system_clock::from_time_t(t);
+    return std::chrono::sys_days(std::chrono::days(serial_));
 }
 
 std::string Date::to_string() const {
     std::ostringstream oss;
-    oss << std::setfill('0') << std::setw(4) << year_ << "-" << std::setw(2) << month_ << "-" << std::setw(2) << day_;
+    const CivilDate c = civil();
+    oss << std::setfill('0') << std::setw(4) << c.year << "-" << std::setw(2) << c.month << "-" << std::setw(2) << c.day;
     return oss.str();
 }
 
@@ -44,7 +36,8 @@ DateTime::DateTime(int y, unsigned m, unsigned d, unsigned hh, unsigned mm, unsi
 
 Date DateTime::date() const {
     auto tt = std::chrono::system_clock::to_time_t(tp_);
-    std::tm tm = *std::localtime(&tt);
+    std::tm tm{};
+    localtime_r(&tt, &tm);
     return Date(tm.tm_year + 1900, static_cast<unsigned>(tm.tm_mon + 1), static_cast<unsigned>(tm.tm_mday));
 }
 
@@ -58,54 +51,73 @@ std::string DateTime::to_string() const {
     return std::string(buf);
 }
 
-bool Calendar::is_business_day(const Date& d) const {
-    auto tt = std::chrono::system_clock::to_time_t(d.to_time_point());
-    std::tm tm = *std::localtime(&tt);
-    int wday = tm.tm_wday; // 0 = Sunday
-    if (wday == 0 || wday == 6) return false;
-    return holidays_.find(d) == holidays_.end();
+Calendar::Calendar(const std::set<Date>& holidays, int first_year, int last_year) {
+    if (last_year < first_year) throw DataError("Calendar range ends before it starts");
+    first_ = Date(first_year, 1, 1).serial();
+    days_ = static_cast<std::size_t>(Date(last_year, 12, 31).serial() - first_ + 1);
+    bits_.assign(days_ / 64 + 1, 0);
+    for (std::size_t i = 0; i < days_; ++i) {
+        if (!Date::from_serial(first_ + static_cast<int>(i)).is_weekend()) bits_[i >> 6] |= std::uint64_t{1} << (i & 63);
+    }
+    for (const Date& d : holidays) {
+        if (d.serial() < first_ || d.serial() >= first_ + static_cast<int>(days_)) continue;
+        const std::size_t i = static_cast<std::size_t>(d.serial() - first_);
+        bits_[i >> 6] &= ~(std::uint64_t{1} << (i & 63));
+    }
+    count();
 }
 
-Date Calendar::adjust(const Date& d) const {
-    Date adj = d;
-    while (!is_business_day(adj)) {
-        adj = advance(adj, 1);
+Calendar Calendar::joint(const Calendar& a, const Calendar& b, JointRule rule) {
+    if (a.first_ != b.first_ || a.days_ != b.days_) throw DataError("Joint calendars need the same year range");
+    Calendar joint = a;
+    for (std::size_t w = 0; w < joint.bits_.size(); ++w) {
+        if (rule == JointRule::Holidays) joint.bits_[w] &= b.bits_[w];
+        else joint.bits_[w] |= b.bits_[w];
     }
-    return adj;
+    joint.count();
+    return joint;
 }
 
-Date Calendar::advance(const Date& d, int days) const {
-    auto tp = d.to_time_point() + std::chrono::hours{24 * days};
-    auto tt = std::chrono::system_clock::to_time_t(tp);
-    std::tm tm = *std::localtime(&tt);
-    return Date(tm.tm_year + 1900, static_cast<unsigned>(tm.tm_mon + 1), static_cast<unsigned>(tm.tm_mday));
+void Calendar::count() {
+    words_before_.resize(bits_.size());
+    business_.clear();
+    std::uint32_t total = 0;
+    for (std::size_t w = 0; w < bits_.size(); ++w) {
+        words_before_[w] = total;
+        for (std::uint64_t word = bits_[w]; word != 0; word &= word - 1) {
+            business_.push_back(static_cast<std::uint32_t>(w * 64 + static_cast<std::size_t>(std::countr_zero(word))));
+        }
+        total = static_cast<std::uint32_t>(business_.size());
+    }
 }
 
-long day_count(const Date& start, const Date& end, DayCountConvention conv) {
-    auto delta = std::chrono::duration_cast<std::chrono::hours>(end.to_time_point() - start.to_time_point()).count() / 24;
-    if (conv == DayCountConvention::THIRTY_360) {
-        auto d1 = start.day();
-        auto d2 = end.day();
-        auto m1 = start.month();
-        auto m2 = end.month();
-        auto y1 = start.year();
-        auto y2 = end.year();
-        return (360 * (y2 - y1) + 30 * static_cast<long>(m2 - m1) + (static_cast<long>(d2) - static_cast<long>(d1)));
+Date Calendar::business_day(long index) const {
+    if (index < 0 || index >= static_cast<long>(business_.size())) {
+        throw DataError("Business day outside the calendar range");
     }
-    return delta;
+    return Date::from_serial(first_ + static_cast<int>(business_[static_cast<std::size_t>(index)]));
 }
 
-double year_fraction(const Date& start, const Date& end, DayCountConvention conv) {
-    double days = static_cast<double>(day_count(start, end, conv));
-    switch (conv) {
-    case DayCountConvention::ACT_360:
-        return days / 360.0;
-    case DayCountConvention::ACT_365:
-        return days / 365.0;
-    case DayCountConvention::THIRTY_360:
-        return days / 360.0;
-    }
-    return days / 365.0;
+Date Calendar::advance_business_days(const Date& d, long n) const {
+    const long r = rank(d);
+    if (n > 0) return business_day(r + n - (is_business_day(d) ? 0 : 1));
+    if (n < 0) return business_day(r + n);
+    return adjust(d, BusinessDayConvention::Following);
+}
+
+Date Calendar::adjust(const Date& d, BusinessDayConvention convention) const {
+    if (convention == BusinessDayConvention::Unadjusted || is_business_day(d)) return d;
+    const long r = rank(d);
+    if (convention == BusinessDayConvention::Preceding) return business_day(r - 1);
+    Date next = business_day(r);
+    if (convention == BusinessDayConvention::ModifiedFollowing && next.month() != d.month()) return business_day(r - 1);
+    return next;
+}
+
+void Calendar::add_holiday(const Date& d) {
+    const std::size_t i = offset(d, false);
+    bits_[i >> 6] &= ~(std::uint64_t{1} << (i & 63));
+    count();
 }
 
 } // namespace quant::core
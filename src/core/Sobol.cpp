@@ -0,0 +1,140 @@
+#include "quant/core/Sobol.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Random.hpp"
+
+#include <bit>
+#include <string>
+
+namespace quant::core {
+
+namespace {
+// Joe-Kuo direction numbers for dimensions 2..37: degree s, polynomial coefficients a, initial m_1..m_s.
+struct Primitive {
+    unsigned s;
+    unsigned a;
+    std::uint32_t m[7];
+};
+
+constexpr Primitive kJoeKuo[] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}},
+    {7, 7, {1, 1, 3, 13, 7, 35, 63}},
+    {7, 8, {1, 3, 5, 9, 1, 25, 53}},
+    {7, 14, {1, 3, 1, 13, 9, 35, 107}},
+    {7, 19, {1, 3, 1, 5, 27, 61, 31}},
+    {7, 21, {1, 1, 5, 11, 19, 41, 61}},
+    {7, 28, {1, 3, 5, 3, 3, 13, 69}},
+    {7, 31, {1, 1, 7, 13, 1, 19, 1}},
+    {7, 32, {1, 3, 7, 5, 13, 19, 59}},
+    {7, 37, {1, 1, 3, 9, 25, 29, 41}},
+    {7, 41, {1, 3, 5, 13, 23, 1, 55}},
+    {7, 42, {1, 3, 7, 3, 13, 59, 17}},
+    {7, 50, {1, 3, 1, 3, 5, 53, 69}},
+    {7, 55, {1, 1, 5, 5, 23, 33, 13}},
+    {7, 56, {1, 1, 7, 7, 1, 61, 123}},
+    {7, 59, {1, 1, 7, 9, 13, 61, 49}},
+    {7, 62, {1, 3, 3, 5, 3, 55, 33}},
+};
+
+constexpr std::size_t kBits = SobolSequence::kBits;
+
+// Direction numbers v_i = m_i 2^(32 - i) (1-based i) of one dimension.
+void directions(std::size_t dim, std::uint32_t* v) {
+    if (dim == 0) {
+        for (std::size_t i = 0; i < kBits; ++i) v[i] = 1u << (kBits - 1 - i);
+        return;
+    }
+    const Primitive& p = kJoeKuo[dim - 1];
+    std::uint32_t m[kBits];
+    for (std::size_t i = 0; i < kBits; ++i) {
+        if (i < p.s) {
+            m[i] = p.m[i];
+            continue;
+        }
+        m[i] = m[i - p.s] ^ (m[i - p.s] << p.s);
+        for (unsigned k = 1; k < p.s; ++k) {
+            if ((p.a >> (p.s - 1 - k)) & 1u) m[i] ^= m[i - k] << k;
+        }
+    }
+    for (std::size_t i = 0; i < kBits; ++i) v[i] = m[i] << (kBits - 1 - i);
+}
+
+// Random lower-triangular binary matrix with unit diagonal applied to the digits of v (most
+// significant digit first), i.e. a linear scramble that keeps the net structure.
+std::uint32_t linear_scramble(std::uint32_t v, const std::uint32_t* columns) {
+    std::uint32_t out = 0;
+    for (std::size_t j = 0; j < kBits; ++j) {
+        if ((v >> (kBits - 1 - j)) & 1u) out ^= columns[j];
+    }
+    return out;
+}
+}
+
+SobolSequence::SobolSequence(std::size_t dimension, bool scramble, std::uint64_t seed)
+    : dimension_(dimension), directions_(dimension * kBits), shift_(dimension, 0u) {
+    if (dimension == 0 || dimension > max_dimension()) {
+        throw DataError("Sobol dimension must be between 1 and " + std::to_string(max_dimension()));
+    }
+    Philox4x32::Key key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+    for (std::size_t d = 0; d < dimension_; ++d) {
+        std::uint32_t* v = &directions_[d * kBits];
+        directions(d, v);
+        if (!scramble) continue;
+        std::uint32_t columns[kBits];
+        for (std::size_t j = 0; j < kBits; j += 4) {
+            auto r = Philox4x32::generate({static_cast<std::uint32_t>(j), static_cast<std::uint32_t>(d), 0x50B01u, 0u},
+                                          key);
+            for (std::size_t c = 0; c < 4; ++c) {
+                std::uint32_t diagonal = 1u << (kBits - 1 - (j + c));
+                columns[j + c] = diagonal | (r[c] & (diagonal - 1u));
+            }
+        }
+        for (std::size_t i = 0; i < kBits; ++i) v[i] = linear_scramble(v[i], columns);
+        shift_[d] = Philox4x32::generate({0u, static_cast<std::uint32_t>(d), 0x50B02u, 0u}, key)[0];
+    }
+}
+
+std::size_t SobolSequence::max_dimension() { return 1 + sizeof(kJoeKuo) / sizeof(kJoeKuo[0]); }
+
+SobolSequence::Cursor::Cursor(const SobolSequence& seq, std::uint64_t index)
+    : seq_(&seq), state_(seq.dimension_, 0u), index_(index) {
+    if (index >> kBits) throw DataError("Sobol index beyond 2^32 points");
+    std::uint64_t gray = index ^ (index >> 1);
+    for (std::size_t b = 0; gray; ++b, gray >>= 1) {
+        if (!(gray & 1u)) continue;
+        for (std::size_t d = 0; d < state_.size(); ++d) state_[d] ^= seq.directions_[d * kBits + b];
+    }
+}
+
+void SobolSequence::Cursor::next(double* out) {
+    constexpr double scale = 1.0 / 4294967296.0;
+    const std::size_t dim = state_.size();
+    for (std::size_t d = 0; d < dim; ++d) {
+        out[d] = (static_cast<double>(state_[d] ^ seq_->shift_[d]) + 0.5) * scale;
+    }
+    ++index_;
+    if (index_ >> kBits) throw DataError("Sobol index beyond 2^32 points");
+    // Gray-code order: consecutive points differ by the direction of the lowest set bit of the index.
+    std::size_t c = static_cast<std::size_t>(std::countr_zero(index_));
+    for (std::size_t d = 0; d < dim; ++d) state_[d] ^= seq_->directions_[d * kBits + c];
+}
+
+} // namespace quant::core
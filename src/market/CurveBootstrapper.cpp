@@ -0,0 +1,286 @@
+#include "quant/market/CurveBootstrapper.hpp"
+#include "quant/core/Exceptions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <tuple>
+
+namespace quant::market {
+
+CurveBootstrapper::CurveBootstrapper(CurveInterpolation interpolation, BootstrapSettings settings)
+    : interpolation_(interpolation), settings_(settings) {
+    if (interpolation_ == CurveInterpolation::MonotoneConvex) {
+        throw quant::core::DataError("Bootstrapping needs a local interpolation (linear zero or log-linear)");
+    }
+}
+
+std::uint32_t CurveBootstrapper::time_index(Helper& h, double t) {
+    auto it = std::find(h.times.begin(), h.times.end(), t);
+    if (it != h.times.end()) return static_cast<std::uint32_t>(it - h.times.begin());
+    h.times.push_back(t);
+    return static_cast<std::uint32_t>(h.times.size() - 1);
+}
+
+std::size_t CurveBootstrapper::add(Helper h) {
+    helpers_.push_back(std::move(h));
+    laid_out_ = false;
+    return helpers_.size() - 1;
+}
+
+std::size_t CurveBootstrapper::add_deposit(double maturity, double rate) {
+    if (!(maturity > 0.0)) throw quant::core::DataError("Deposit maturity must be positive");
+    Helper h;
+    h.quote = rate;
+    h.tau = maturity;
+    h.pillar = maturity;
+    h.spec.push_back({TermKind::Log, time_index(h, 0.0), time_index(h, maturity), 0.0});
+    return add(std::move(h));
+}
+
+std::size_t CurveBootstrapper::add_fra(double start, double end, double rate) {
+    if (!(start >= 0.0) || !(end > start)) throw quant::core::DataError("FRA needs 0 <= start < end");
+    Helper h;
+    h.quote = rate;
+    h.tau = end - start;
+    h.pillar = end;
+    h.spec.push_back({TermKind::Log, time_index(h, start), time_index(h, end), 0.0});
+    return add(std::move(h));
+}
+
+std::size_t CurveBootstrapper::add_swap(const quant::instruments::VanillaSwap& swap) {
+    // Per unit notional: float leg minus fixed leg, the terms of VanillaSwap::npv.
+    Helper h;
+    h.quote = swap.fixed_rate();
+    const auto& cf = swap.cashflows();
+    for (std::size_t i = 0; i < cf.fixed_time.size(); ++i) {
+        std::uint32_t n = time_index(h, cf.fixed_time[i]);
+        h.spec.push_back({TermKind::Fixed, n, n, cf.fixed_accrual[i]});
+        h.pillar = std::max(h.pillar, cf.fixed_time[i]);
+    }
+    for (std::size_t i = 1; i < cf.float_time.size(); ++i) {
+        double t1 = cf.float_time[i - 1], t2 = cf.float_time[i];
+        h.spec.push_back({TermKind::Float, time_index(h, t1), time_index(h, t2), swap.float_spread() * (t2 - t1)});
+        h.pillar = std::max(h.pillar, t2);
+    }
+    if (!(h.pillar > 0.0)) throw quant::core::DataError("Swap has no cashflows");
+    return add(std::move(h));
+}
+
+void CurveBootstrapper::set_quote(std::size_t index, double quote) {
+    helpers_.at(index).quote = quote;
+    if (laid_out_) dirty_from_ = std::min(dirty_from_, position_[index]);
+}
+
+void CurveBootstrapper::layout() {
+    const std::size_t n = helpers_.size();
+    if (n == 0) throw quant::core::DataError("No instruments to bootstrap");
+    order_.resize(n);
+    std::iota(order_.begin(), order_.end(), std::size_t{0});
+    std::sort(order_.begin(), order_.end(),
+              [&](std::size_t a, std::size_t b) { return helpers_[a].pillar < helpers_[b].pillar; });
+    position_.resize(n);
+    times_.resize(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        position_[order_[k]] = k;
+        times_[k] = helpers_[order_[k]].pillar;
+        if (k > 0 && !(times_[k] > times_[k - 1])) {
+            throw quant::core::DataError("Bootstrap instruments share a pillar");
+        }
+    }
+    rates_.assign(n, std::numeric_limits<double>::quiet_NaN());
+    curve_ = YieldCurve();
+
+    std::vector<double> all;
+    for (const Helper& h : helpers_) all.insert(all.end(), h.times.begin(), h.times.end());
+    std::sort(all.begin(), all.end());
+    all.erase(std::unique(all.begin(), all.end()), all.end());
+    nodes_.clear();
+    segment_nodes_.assign(n + 1, 0);
+    for (double t : all) {
+        auto m = static_cast<std::size_t>(std::lower_bound(times_.begin(), times_.end(), t) - times_.begin());
+        Node nd{t, 0.0, t, static_cast<std::uint32_t>(m)};
+        if (m > 0) {
+            double w = (t - times_[m - 1]) / (times_[m] - times_[m - 1]);
+            bool linear = interpolation_ == CurveInterpolation::LinearZero;
+            nd.alpha = (1.0 - w) * (linear ? t : times_[m - 1]);
+            nd.beta = w * (linear ? t : times_[m]);
+        }
+        nodes_.push_back(nd);
+        ++segment_nodes_[m + 1];
+    }
+    std::partial_sum(segment_nodes_.begin(), segment_nodes_.end(), segment_nodes_.begin());
+    node_y_.assign(nodes_.size(), 0.0);
+    node_df_.assign(nodes_.size(), 1.0);
+
+    auto key = [](const Term& t) { return std::make_tuple(t.n2, t.kind, t.n1, t.c); };
+    terms_.clear();
+    for (std::size_t k = 0; k < n; ++k) {
+        Helper& h = helpers_[order_[k]];
+        auto global = [&](std::uint32_t i) {
+            return static_cast<std::uint32_t>(std::lower_bound(all.begin(), all.end(), h.times[i]) - all.begin());
+        };
+        h.terms.clear();
+        for (const Term& t : h.spec) h.terms.push_back({t.kind, global(t.n1), global(t.n2), t.c});
+        std::stable_sort(h.terms.begin(), h.terms.end(),
+                         [&](const Term& a, const Term& b) { return nodes_[a.n2].segment < nodes_[b.n2].segment; });
+        h.segment_begin.assign(k + 2, 0);
+        for (const Term& t : h.terms) ++h.segment_begin[nodes_[t.n2].segment + 1];
+        std::partial_sum(h.segment_begin.begin(), h.segment_begin.end(), h.segment_begin.begin());
+        h.partial_p.assign(k, 0.0);
+        h.partial_q.assign(k, 0.0);
+        terms_.insert(terms_.end(), h.terms.begin(), h.terms.end());
+    }
+    // Node order is time order, so sorting by payment node also groups the terms by segment.
+    auto less = [&](const Term& a, const Term& b) { return key(a) < key(b); };
+    std::sort(terms_.begin(), terms_.end(), less);
+    terms_.erase(std::unique(terms_.begin(), terms_.end(), [&](const Term& a, const Term& b) { return key(a) == key(b); }),
+                 terms_.end());
+    segment_terms_.assign(n + 1, 0);
+    for (const Term& t : terms_) ++segment_terms_[nodes_[t.n2].segment + 1];
+    std::partial_sum(segment_terms_.begin(), segment_terms_.end(), segment_terms_.begin());
+    term_p_.assign(terms_.size(), 0.0);
+    term_q_.assign(terms_.size(), 0.0);
+    for (Helper& h : helpers_) {
+        h.ids.clear();
+        for (const Term& t : h.terms) {
+            h.ids.push_back(static_cast<std::uint32_t>(std::lower_bound(terms_.begin(), terms_.end(), t, less) - terms_.begin()));
+        }
+    }
+    laid_out_ = true;
+    dirty_from_ = 0;
+}
+
+double CurveBootstrapper::y(const Node& n) const {
+    double y = n.beta * rates_[n.segment];
+    return n.segment > 0 ? y + n.alpha * rates_[n.segment - 1] : y;
+}
+
+double CurveBootstrapper::residual(const Helper& h, std::size_t k, double p, double q, double& derivative) {
+    refresh(k);
+    double r = p + h.quote * q;
+    double dr = 0.0;
+    for (std::uint32_t i = h.segment_begin[k]; i < h.segment_begin[k + 1]; ++i) {
+        const Term& term = h.terms[i];
+        double df2 = node_df_[term.n2], dy2 = nodes_[term.n2].beta;
+        if (term.kind == TermKind::Fixed) {
+            r -= h.quote * term.c * df2;
+            dr += h.quote * term.c * dy2 * df2;
+            continue;
+        }
+        double y = node_y_[term.n2] - node_y_[term.n1];
+        double dy = nodes_[term.n1].segment == k ? dy2 - nodes_[term.n1].beta : dy2;
+        if (term.kind == TermKind::Float) {
+            r += (y + term.c) * df2;
+            dr += (dy - (y + term.c) * dy2) * df2;
+        } else {
+            r += y;
+            dr += dy;
+        }
+    }
+    if (h.tau > 0.0) r -= std::log1p(h.quote * h.tau);
+    derivative = dr;
+    return r;
+}
+
+void CurveBootstrapper::refresh(std::size_t k) {
+    for (std::uint32_t i = segment_nodes_[k]; i < segment_nodes_[k + 1]; ++i) {
+        node_y_[i] = y(nodes_[i]);
+        node_df_[i] = std::exp(-node_y_[i]);
+    }
+    value_terms(k);
+}
+
+void CurveBootstrapper::shift(std::size_t k, double step) {
+    // exp(beta step) = 1 + beta step to rounding for converged steps.
+    for (std::uint32_t i = segment_nodes_[k]; i < segment_nodes_[k + 1]; ++i) {
+        node_y_[i] += nodes_[i].beta * step;
+        node_df_[i] *= 1.0 - nodes_[i].beta * step;
+    }
+    value_terms(k);
+}
+
+void CurveBootstrapper::value_terms(std::size_t k) {
+    for (std::uint32_t i = segment_terms_[k]; i < segment_terms_[k + 1]; ++i) {
+        const Term& term = terms_[i];
+        if (term.kind == TermKind::Fixed) {
+            term_q_[i] = -term.c * node_df_[term.n2];
+        } else if (term.kind == TermKind::Float) {
+            term_p_[i] = (node_y_[term.n2] - node_y_[term.n1] + term.c) * node_df_[term.n2];
+        } else {
+            term_p_[i] = node_y_[term.n2] - node_y_[term.n1];
+        }
+    }
+}
+
+void CurveBootstrapper::solve(std::size_t k, std::size_t from) {
+    Helper& h = helpers_[order_[k]];
+    // partial_p[m], partial_q[m]: sums over segments 0..m, kept below `from`.
+    double p = from > 0 ? h.partial_p[from - 1] : 0.0;
+    double q = from > 0 ? h.partial_q[from - 1] : 0.0;
+    for (std::size_t m = from; m < k; ++m) {
+        for (std::uint32_t i = h.segment_begin[m]; i < h.segment_begin[m + 1]; ++i) {
+            p += term_p_[h.ids[i]];
+            q += term_q_[h.ids[i]];
+        }
+        h.partial_p[m] = p;
+        h.partial_q[m] = q;
+    }
+
+    double& rate = rates_[k];
+    if (!std::isfinite(rate)) rate = k > 0 ? rates_[k - 1] : 0.0;
+    double dr = 0.0;
+    for (std::size_t it = 0; it < settings_.max_iterations; ++it) {
+        double r = residual(h, k, p, q, dr);
+        double step = r / dr;
+        if (!std::isfinite(step)) break;
+        rate -= step;
+        if (std::fabs(step) <= settings_.accuracy) {
+            shift(k, -step);
+            return;
+        }
+    }
+
+    // Bisection over [-100%, 100%] when Newton does not converge.
+    double lo = -1.0, hi = 1.0;
+    rate = lo;
+    double r_lo = residual(h, k, p, q, dr);
+    rate = hi;
+    double r_hi = residual(h, k, p, q, dr);
+    if (!(r_lo * r_hi <= 0.0)) {
+        throw quant::core::PricingError("Curve bootstrap failed at pillar " + std::to_string(times_[k]));
+    }
+    while (hi - lo > settings_.accuracy) {
+        rate = 0.5 * (lo + hi);
+        double r = residual(h, k, p, q, dr);
+        if ((r < 0.0) == (r_lo < 0.0)) {
+            lo = rate;
+            r_lo = r;
+        } else {
+            hi = rate;
+        }
+    }
+    rate = 0.5 * (lo + hi);
+    refresh(k);
+}
+
+const YieldCurve& CurveBootstrapper::curve() {
+    if (!laid_out_) layout();
+    const std::size_t n = helpers_.size();
+    if (dirty_from_ < n) {
+        for (std::size_t k = dirty_from_; k < n; ++k) {
+            solve(k, dirty_from_);
+        }
+        if (curve_.times().empty()) {
+            curve_ = YieldCurve(times_, rates_, interpolation_);
+        } else {
+            curve_.set_zero_rates(rates_);
+        }
+        dirty_from_ = n;
+    }
+    return curve_;
+}
+
+} // namespace quant::market
@@ -0,0 +1,320 @@
+#include "quant/market/MarketDataFile.hpp"
+#include "quant/core/Exceptions.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace quant::market {
+
+namespace {
+constexpr char kMagic[8] = {'Q', 'M', 'K', 'T', 'D', 'A', 'T', 'A'};
+
+enum class Kind : std::uint32_t { Curve = 1, Surface = 2, FX = 3, Equity = 4 };
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t layout;
+    std::uint64_t size;     // of the whole file
+    std::uint64_t checksum; // of everything after the header
+    std::uint64_t records;
+};
+
+// Every record starts with a tag and its name, then its fields and arrays, each padded to 8 bytes.
+struct Tag {
+    Kind kind;
+    std::uint32_t name_size;
+};
+struct CurveFields {
+    std::uint32_t interpolation;
+    std::uint32_t pillars;
+    std::uint32_t shapes;
+    std::uint32_t buckets;
+    double inv_bucket;
+    double front_rate;
+};
+struct SurfaceFields {
+    std::uint32_t interpolation;
+    std::uint32_t strikes;
+    std::uint32_t tenors;
+    std::uint32_t slopes;
+    std::uint32_t strike_buckets;
+    std::uint32_t tenor_buckets;
+    double strike_inv_bucket;
+    double tenor_inv_bucket;
+};
+
+// Four multiply-rotate lanes over 8-byte words: enough to catch torn or corrupted files at
+// memory speed.
+std::uint64_t checksum(const unsigned char* p, std::size_t n) {
+    constexpr std::uint64_t k = 0x9fb21c651e98df25ull;
+    std::uint64_t h[4] = {0x9e3779b97f4a7c15ull, 0xbf58476d1ce4e5b9ull, 0x94d049bb133111ebull, 0x2545f4914f6cdd1dull};
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        for (int l = 0; l < 4; ++l) {
+            std::uint64_t w;
+            std::memcpy(&w, p + i + 8 * l, 8);
+            h[l] = std::rotl((h[l] ^ w) * k, 29);
+        }
+    }
+    for (int l = 0; i < n; i += 8, ++l) {
+        std::uint64_t w = 0;
+        std::memcpy(&w, p + i, std::min<std::size_t>(8, n - i));
+        h[l] = std::rotl((h[l] ^ w) * k, 29);
+    }
+    std::uint64_t out = n;
+    for (std::uint64_t lane : h) out = std::rotl((out ^ lane) * k, 31);
+    return out;
+}
+
+class Writer {
+public:
+    template <typename T>
+    void put(const T& value) {
+        put_bytes(&value, sizeof(T));
+    }
+    template <typename T>
+    void put(std::span<const T> values) {
+        put_bytes(values.data(), values.size_bytes());
+    }
+    void put_name(Kind kind, const std::string& name) {
+        put(Tag{kind, static_cast<std::uint32_t>(name.size())});
+        put_bytes(name.data(), name.size());
+    }
+    std::vector<unsigned char>& bytes() { return bytes_; }
+
+private:
+    void put_bytes(const void* p, std::size_t n) {
+        const auto* b = static_cast<const unsigned char*>(p);
+        bytes_.insert(bytes_.end(), b, b + n);
+        bytes_.resize((bytes_.size() + 7) & ~std::size_t{7}, 0);
+    }
+
+    std::vector<unsigned char> bytes_;
+};
+
+class Reader {
+public:
+    Reader(const unsigned char* begin, const unsigned char* end) : p_(begin), end_(end) {}
+
+    template <typename T>
+    T get() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+    template <typename T>
+    std::span<const T> array(std::size_t n) {
+        return {reinterpret_cast<const T*>(take(n * sizeof(T))), n};
+    }
+    std::string name(std::size_t n) { return {reinterpret_cast<const char*>(take(n)), n}; }
+
+private:
+    const unsigned char* take(std::size_t n) {
+        std::size_t padded = (n + 7) & ~std::size_t{7};
+        if (static_cast<std::size_t>(end_ - p_) < padded) throw quant::core::DataError("Truncated market data file");
+        const unsigned char* at = p_;
+        p_ += padded;
+        return at;
+    }
+
+    const unsigned char* p_;
+    const unsigned char* end_;
+};
+
+void corrupt(bool bad) {
+    if (bad) throw quant::core::DataError("Corrupt market data file");
+}
+
+template <typename Map>
+std::vector<const typename Map::value_type*> sorted(const Map& map) {
+    std::vector<const typename Map::value_type*> entries;
+    for (const auto& entry : map) entries.push_back(&entry);
+    std::sort(entries.begin(), entries.end(), [](auto* a, auto* b) { return a->first < b->first; });
+    return entries;
+}
+}
+
+struct MarketDataFile::Codec {
+    using Segment = YieldCurve::Segment;
+    using Shape = YieldCurve::Shape;
+
+    // Struct sizes and byte order of the writing build.
+    static constexpr std::uint32_t layout = static_cast<std::uint32_t>(
+        sizeof(Segment) | sizeof(Shape) << 8 | (std::endian::native == std::endian::little ? 1u : 2u) << 16);
+
+    static void put(Writer& w, const YieldCurve& c) {
+        if (c.times_.empty()) throw quant::core::DataError("Cannot write an empty yield curve");
+        w.put(CurveFields{static_cast<std::uint32_t>(c.interpolation_), static_cast<std::uint32_t>(c.times_.size()),
+                          static_cast<std::uint32_t>(c.shapes_.size()), static_cast<std::uint32_t>(c.bucket_.size()),
+                          c.inv_bucket_, c.front_rate_});
+        w.put(c.times_.span());
+        w.put(c.zero_rates_.span());
+        w.put(c.segments_.span());
+        w.put(c.shapes_.span());
+        w.put(c.bucket_.span());
+    }
+
+    static void put(Writer& w, const VolSurface& s) {
+        if (s.strikes_.empty() || s.tenors_.empty()) throw quant::core::DataError("Cannot write an empty vol surface");
+        const bool slopes = !s.d_strike_.empty();
+        w.put(SurfaceFields{static_cast<std::uint32_t>(s.interpolation_), static_cast<std::uint32_t>(s.strikes_.size()),
+                            static_cast<std::uint32_t>(s.tenors_.size()), slopes ? 1u : 0u,
+                            static_cast<std::uint32_t>(s.strike_axis_.bucket.size()),
+                            static_cast<std::uint32_t>(s.tenor_axis_.bucket.size()), s.strike_axis_.inv_bucket,
+                            s.tenor_axis_.inv_bucket});
+        for (const auto* a : {&s.strikes_, &s.tenors_, &s.vols_, &s.strike_axis_.inv, &s.tenor_axis_.inv}) w.put(a->span());
+        w.put(s.strike_axis_.bucket.span());
+        w.put(s.tenor_axis_.bucket.span());
+        if (slopes) {
+            for (const auto* a : {&s.d_strike_, &s.d_tenor_, &s.d_cross_}) w.put(a->span());
+        }
+    }
+
+    static YieldCurve curve(Reader& r, const std::shared_ptr<const void>& keep) {
+        using quant::core::Buffer;
+        auto f = r.get<CurveFields>();
+        corrupt(f.pillars == 0 || f.interpolation > 2 || (f.pillars > 1 && f.buckets == 0) ||
+                (f.shapes != 0 && f.shapes != f.pillars + 1));
+        YieldCurve c;
+        c.interpolation_ = static_cast<CurveInterpolation>(f.interpolation);
+        c.inv_bucket_ = f.inv_bucket;
+        c.front_rate_ = f.front_rate;
+        c.times_ = Buffer<double>::borrow(r.array<double>(f.pillars), keep);
+        c.zero_rates_ = Buffer<double>::borrow(r.array<double>(f.pillars), keep);
+        c.segments_ = Buffer<Segment>::borrow(r.array<Segment>(f.pillars + std::size_t{1}), keep);
+        c.shapes_ = Buffer<Shape>::borrow(r.array<Shape>(f.shapes), keep);
+        c.bucket_ = Buffer<std::uint32_t>::borrow(r.array<std::uint32_t>(f.buckets), keep);
+        return c;
+    }
+
+    static VolSurface surface(Reader& r, const std::shared_ptr<const void>& keep) {
+        using quant::core::Buffer;
+        auto f = r.get<SurfaceFields>();
+        corrupt(f.strikes == 0 || f.tenors == 0 || f.interpolation > 2 || (f.strikes > 1 && f.strike_buckets == 0) ||
+                (f.tenors > 1 && f.tenor_buckets == 0));
+        const std::size_t nodes = std::size_t{f.strikes} * f.tenors;
+        VolSurface s;
+        s.interpolation_ = static_cast<VolInterpolation>(f.interpolation);
+        s.strikes_ = Buffer<double>::borrow(r.array<double>(f.strikes), keep);
+        s.tenors_ = Buffer<double>::borrow(r.array<double>(f.tenors), keep);
+        s.vols_ = Buffer<double>::borrow(r.array<double>(nodes), keep);
+        s.strike_axis_.inv = Buffer<double>::borrow(r.array<double>(f.strikes - std::size_t{1}), keep);
+        s.tenor_axis_.inv = Buffer<double>::borrow(r.array<double>(f.tenors - std::size_t{1}), keep);
+        s.strike_axis_.bucket = Buffer<std::uint32_t>::borrow(r.array<std::uint32_t>(f.strike_buckets), keep);
+        s.tenor_axis_.bucket = Buffer<std::uint32_t>::borrow(r.array<std::uint32_t>(f.tenor_buckets), keep);
+        s.strike_axis_.inv_bucket = f.strike_inv_bucket;
+        s.tenor_axis_.inv_bucket = f.tenor_inv_bucket;
+        if (f.slopes) {
+            s.d_strike_ = Buffer<double>::borrow(r.array<double>(nodes), keep);
+            s.d_tenor_ = Buffer<double>::borrow(r.array<double>(nodes), keep);
+            s.d_cross_ = Buffer<double>::borrow(r.array<double>(nodes), keep);
+        }
+        corrupt((s.interpolation_ == VolInterpolation::Bicubic) != (f.slopes != 0));
+        return s;
+    }
+};
+
+void MarketDataFile::write(const MarketData& data, const std::string& path) {
+    Writer w;
+    w.bytes().resize(sizeof(Header));
+    for (const auto* e : sorted(data.curves_)) {
+        w.put_name(Kind::Curve, e->first);
+        Codec::put(w, e->second);
+    }
+    for (const auto* e : sorted(data.surfaces_)) {
+        w.put_name(Kind::Surface, e->first);
+        Codec::put(w, e->second);
+    }
+    for (const auto* e : sorted(data.fx_spots_)) {
+        w.put_name(Kind::FX, e->first);
+        w.put(e->second.value());
+    }
+    for (const auto* e : sorted(data.equity_spots_)) {
+        w.put_name(Kind::Equity, e->first);
+        w.put(e->second.value());
+    }
+
+    auto& bytes = w.bytes();
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = format_version;
+    header.layout = Codec::layout;
+    header.size = bytes.size();
+    header.checksum = checksum(bytes.data() + sizeof(Header), bytes.size() - sizeof(Header));
+    header.records = data.curves_.size() + data.surfaces_.size() + data.fx_spots_.size() + data.equity_spots_.size();
+    std::memcpy(bytes.data(), &header, sizeof(Header));
+
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!out.flush()) throw quant::core::DataError("Cannot write market data file " + tmp);
+    }
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        throw quant::core::DataError("Cannot write market data file " + path);
+    }
+}
+
+MarketData MarketDataFile::map(const std::string& path, bool verify) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) throw quant::core::DataError("Cannot open market data file " + path);
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        throw quant::core::DataError("Truncated market data file");
+    }
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) throw quant::core::DataError("Cannot map market data file " + path);
+    std::shared_ptr<const void> mapping(addr, [size](const void* p) { ::munmap(const_cast<void*>(p), size); });
+
+    const auto* bytes = static_cast<const unsigned char*>(addr);
+    Header header;
+    std::memcpy(&header, bytes, sizeof(Header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) throw quant::core::DataError("Not a market data file");
+    if (header.version != format_version) throw quant::core::DataError("Unsupported market data file version");
+    if (header.layout != Codec::layout) throw quant::core::DataError("Market data file layout mismatch");
+    if (header.size != size) throw quant::core::DataError("Truncated market data file");
+    if (verify && checksum(bytes + sizeof(Header), size - sizeof(Header)) != header.checksum) {
+        throw quant::core::DataError("Market data file checksum mismatch");
+    }
+
+    MarketData data;
+    Reader r(bytes + sizeof(Header), bytes + size);
+    for (std::uint64_t i = 0; i < header.records; ++i) {
+        auto tag = r.get<Tag>();
+        std::string name = r.name(tag.name_size);
+        switch (tag.kind) {
+        case Kind::Curve:
+            data.curves_.emplace(std::move(name), Codec::curve(r, mapping));
+            break;
+        case Kind::Surface:
+            data.surfaces_.emplace(std::move(name), Codec::surface(r, mapping));
+            break;
+        case Kind::FX:
+            data.fx_spots_.emplace(name, FXSpot(name, r.get<double>()));
+            break;
+        case Kind::Equity:
+            data.equity_spots_.emplace(name, EquitySpot(name, r.get<double>()));
+            break;
+        default:
+            corrupt(true);
+        }
+    }
+    return data;
+}
+
+} // namespace quant::market
@@ -0,0 +1,66 @@
+#include "quant/market/MarketSnapshot.hpp"
+#include "quant/core/Exceptions.hpp"
+
+namespace quant::market {
+
+namespace {
+std::uint32_t intern(std::unordered_map<std::string, std::uint32_t>& names, std::string_view name) {
+    auto it = names.find(std::string(name));
+    if (it != names.end()) return it->second;
+    auto index = static_cast<std::uint32_t>(names.size());
+    names.emplace(std::string(name), index);
+    return index;
+}
+
+template <typename T>
+void apply(std::vector<std::shared_ptr<const T>>& table,
+           std::vector<std::pair<std::uint32_t, std::shared_ptr<const T>>>& changes, std::size_t handles,
+           const char* what) {
+    for (auto& [index, object] : changes) {
+        if (index >= handles) throw quant::core::DataError(std::string("Unknown ") + what + " handle");
+        if (index >= table.size()) table.resize(handles);
+        table[index] = std::move(object);
+    }
+}
+}
+
+MarketUpdate& MarketUpdate::set(CurveHandle h, YieldCurve curve) {
+    curves_.emplace_back(h.index, std::make_shared<const YieldCurve>(std::move(curve)));
+    return *this;
+}
+
+MarketUpdate& MarketUpdate::set(SurfaceHandle h, VolSurface surface) {
+    surfaces_.emplace_back(h.index, std::make_shared<const VolSurface>(std::move(surface)));
+    return *this;
+}
+
+std::uint64_t MarketUpdate::commit() { return store_->commit(*this); }
+
+MarketDataStore::MarketDataStore() : current_(std::make_shared<const MarketSnapshot>()) {}
+
+CurveHandle MarketDataStore::curve_handle(std::string_view name) {
+    std::lock_guard lock(writer_);
+    return {intern(curve_names_, name)};
+}
+
+SurfaceHandle MarketDataStore::surface_handle(std::string_view name) {
+    std::lock_guard lock(writer_);
+    return {intern(surface_names_, name)};
+}
+
+std::uint64_t MarketDataStore::commit(MarketUpdate& update) {
+    // The objects were built by set(); only the pointer tables are copied under the lock.
+    std::lock_guard lock(writer_);
+    auto next = std::make_shared<MarketSnapshot>(*current_.load(std::memory_order_relaxed));
+    apply(next->curves_, update.curves_, curve_names_.size(), "curve");
+    apply(next->surfaces_, update.surfaces_, surface_names_.size(), "surface");
+    update.curves_.clear();
+    update.surfaces_.clear();
+    next->version_ += 1;
+    const std::uint64_t version = next->version_;
+    current_.store(std::move(next), std::memory_order_release);
+    version_.store(version, std::memory_order_release);
+    return version;
+}
+
+} // namespace quant::market
@@ -1,76 +1,160 @@
 #include "quant/pricing/BarrierOption.hpp"
-#include "quant/pricing/BlackScholes.hpp"
 #include "quant/core/Exceptions.hpp"
+#include "quant/core/Math.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace quant::pricing {
 
 namespace {
-inline bool hit_barrier(double price, double barrier, quant::instruments::BarrierType type) {
-    if (type == quant::instruments::BarrierType::UpAndOut || type == quant::instruments::BarrierType::UpAndIn) {
-        return price >= barrier;
-    }
-    return price <= barrier;
+using quant::instruments::BarrierType;
+using quant::instruments::OptionType;
+
+inline bool is_up(BarrierType type) { return type == BarrierType::UpAndOut || type == BarrierType::UpAndIn; }
+
+inline bool is_knock_in(BarrierType type) { return type == BarrierType::UpAndIn || type == BarrierType::DownAndIn; }
+
+inline bool hit_barrier(double price, double barrier, BarrierType type) {
+    return is_up(type) ? price >= barrier : price <= barrier;
 }
+
+inline double vanilla(const quant::instruments::BarrierOption& opt) {
+    return black_scholes<BSPrice>(opt.option_type(), opt.spot(), opt.strike(), opt.maturity(), opt.rate(), 0.0,
+                                  opt.volatility())
+        .price;
 }
 
-double BarrierOptionEngine::price(const quant::instruments::Instrument& inst) const {
+const quant::instruments::BarrierOption& as_barrier(const quant::instruments::Instrument& inst) {
     const auto* opt = dynamic_cast<const quant::instruments::BarrierOption*>(&inst);
     if (!opt) throw quant::core::PricingError("Instrument is not BarrierOption");
-    return price(*opt);
+    return *opt;
+}
 }
 
+double BarrierOptionEngine::price(const quant::instruments::Instrument& inst) const { return price(as_barrier(inst)); }
+
 double BarrierOptionEngine::price(const quant::instruments::BarrierOption& opt) const {
-    using quant::instruments::BarrierType;
-    // Knock-in via parity with knock-out and vanilla
-    if (opt.barrier_type() == BarrierType::UpAndIn || opt.barrier_type() == BarrierType::DownAndIn) {
-        quant::instruments::BarrierType ko =
-            opt.barrier_type() == BarrierType::UpAndIn ? BarrierType::UpAndOut : BarrierType::DownAndOut;
-        quant::instruments::BarrierOption ko_opt(ko, opt.option_type(), opt.spot(), opt.strike(), opt.maturity(),
-                                                 opt.rate(), opt.volatility(), opt.barrier(), opt.rebate());
-        BarrierOptionEngine ko_engine(steps_);
-        double vanilla = BlackScholesEuropeanEngine().price(quant::instruments::EuropeanOption(
-            opt.option_type(), opt.spot(), opt.strike(), opt.maturity(), opt.rate(), opt.volatility()));
-        return vanilla - ko_engine.price(ko_opt);
-    }
+    if (!is_knock_in(opt.barrier_type())) return knock_out(opt, opt.barrier_type(), opt.rebate(), false);
+    // Knock-in via parity with the knock-out; the rebate is a digital paid at expiry on survival.
+    BarrierType ko = is_up(opt.barrier_type()) ? BarrierType::UpAndOut : BarrierType::DownAndOut;
+    double rebate = opt.rebate() == 0.0 ? 0.0 : knock_out(opt, ko, 0.0, true);
+    return vanilla(opt) - knock_out(opt, ko, 0.0, false) + rebate;
+}
 
+double BarrierOptionEngine::knock_out(const quant::instruments::BarrierOption& opt, BarrierType type, double hit_value,
+                                      bool pay_rebate) const {
     std::size_t steps = steps_;
     double dt = opt.maturity() / static_cast<double>(steps);
     double u = std::exp(opt.volatility() * std::sqrt(dt));
     double d = 1.0 / u;
     double disc = std::exp(-opt.rate() * dt);
     double p = (std::exp(opt.rate() * dt) - d) / (u - d);
+    double phi = opt.option_type() == OptionType::Call ? 1.0 : -1.0;
+
+    // Node (step, i) sits at spot * u^(step - 2i); ladder[k] = spot * u^(k - steps).
+    std::vector<double> ladder(2 * steps + 1);
+    ladder[steps] = opt.spot();
+    for (std::size_t k = 1; k <= steps; ++k) {
+        ladder[steps + k] = ladder[steps + k - 1] * u;
+        ladder[steps - k] = ladder[steps - k + 1] * d;
+    }
 
     std::vector<double> values(steps + 1);
     for (std::size_t i = 0; i <= steps; ++i) {
-        double s = opt.spot() * std::pow(u, static_cast<double>(steps - i)) * std::pow(d, static_cast<double>(i));
-        double payoff = 0.0;
-        if (!hit_barrier(s, opt.barrier(), opt.barrier_type())) {
-            if (opt.option_type() == quant::instruments::OptionType::Call) {
-                payoff = std::max(s - opt.strike(), 0.0);
-            } else {
-                payoff = std::max(opt.strike() - s, 0.0);
-            }
-        } else {
-            payoff = opt.rebate();
-        }
-        values[i] = payoff;
+        double s = ladder[2 * (steps - i)];
+        double payoff = pay_rebate ? opt.rebate() : std::max(phi * (s - opt.strike()), 0.0);
+        values[i] = hit_barrier(s, opt.barrier(), type) ? hit_value : payoff;
     }
 
-    for (int step = static_cast<int>(steps) - 1; step >= 0; --step) {
-        for (int i = 0; i <= step; ++i) {
-            double s = opt.spot() * std::pow(u, static_cast<double>(step - i)) * std::pow(d, static_cast<double>(i));
+    for (std::size_t step = steps; step-- > 0;) {
+        for (std::size_t i = 0; i <= step; ++i) {
+            double s = ladder[steps + step - 2 * i];
             double cont = disc * (p * values[i] + (1.0 - p) * values[i + 1]);
-            if (hit_barrier(s, opt.barrier(), opt.barrier_type())) {
-                values[i] = opt.rebate();
-            } else {
-                values[i] = cont;
-            }
+            values[i] = hit_barrier(s, opt.barrier(), type) ? hit_value : cont;
         }
     }
     return values.front();
 }
 
-} // namespace quant::pricing
+double AnalyticBarrierEngine::price(const quant::instruments::Instrument& inst) const {
+    return price(as_barrier(inst));
+}
+
+double AnalyticBarrierEngine::price(const quant::instruments::BarrierOption& opt) const {
+    const BarrierType type = opt.barrier_type();
+    const bool up = is_up(type);
+    const double S = opt.spot();
+    const double X = opt.strike();
+    const double T = opt.maturity();
+    const double r = opt.rate();
+    const double vol = opt.volatility();
+    const double K = opt.rebate();
+
+    double H = opt.barrier();
+    if (monitoring_points_ > 0 && T > 0.0 && vol > 0.0) {
+        constexpr double beta = 0.5825971579390106; // -zeta(1/2) / sqrt(2 pi)
+        double shift = std::exp(beta * vol * std::sqrt(T / static_cast<double>(monitoring_points_)));
+        H = up ? H * shift : H / shift;
+    }
+    if (hit_barrier(S, H, type)) return is_knock_in(type) ? vanilla(opt) : K;
+    if (T <= 0.0 || vol <= 0.0) return 0.0;
+
+    using quant::core::norm_cdf;
+    const double phi = opt.option_type() == OptionType::Call ? 1.0 : -1.0;
+    const double eta = up ? -1.0 : 1.0;
+    const double sd = vol * std::sqrt(T);
+    const double df = std::exp(-r * T);
+    const double mu = (r - 0.5 * vol * vol) / (vol * vol);
+    const double lambda = std::sqrt(mu * mu + 2.0 * r / (vol * vol));
+    const double hs = H / S;
+    const double hs_2mu = std::pow(hs, 2.0 * mu);
+    const double hs_2mu2 = hs_2mu * hs * hs;
 
+    const double x1 = std::log(S / X) / sd + (1.0 + mu) * sd;
+    const double x2 = std::log(S / H) / sd + (1.0 + mu) * sd;
+    const double y1 = std::log(H * H / (S * X)) / sd + (1.0 + mu) * sd;
+    const double y2 = std::log(H / S) / sd + (1.0 + mu) * sd;
+    const double z = std::log(H / S) / sd + lambda * sd;
+
+    auto A = [&] { return phi * S * norm_cdf(phi * x1) - phi * X * df * norm_cdf(phi * (x1 - sd)); };
+    auto B = [&] { return phi * S * norm_cdf(phi * x2) - phi * X * df * norm_cdf(phi * (x2 - sd)); };
+    auto C = [&] {
+        return phi * S * hs_2mu2 * norm_cdf(eta * y1) - phi * X * df * hs_2mu * norm_cdf(eta * (y1 - sd));
+    };
+    auto D = [&] {
+        return phi * S * hs_2mu2 * norm_cdf(eta * y2) - phi * X * df * hs_2mu * norm_cdf(eta * (y2 - sd));
+    };
+    auto E = [&] {
+        if (K == 0.0) return 0.0;
+        return K * df * (norm_cdf(eta * (x2 - sd)) - hs_2mu * norm_cdf(eta * (y2 - sd)));
+    };
+    auto F = [&] {
+        if (K == 0.0) return 0.0;
+        return K * (std::pow(hs, mu + lambda) * norm_cdf(eta * z) +
+                     std::pow(hs, mu - lambda) * norm_cdf(eta * (z - 2.0 * lambda * sd)));
+    };
+
+    // Haug's case table, split on whether the strike lies above the barrier.
+    const bool call = phi > 0.0;
+    const bool x_above = X >= H;
+    switch (type) {
+    case BarrierType::DownAndIn:
+        if (call) return x_above ? C() + E() : A() - B() + D() + E();
+        return x_above ? B() - C() + D() + E() : A() + E();
+    case BarrierType::UpAndIn:
+        if (call) return x_above ? A() + E() : B() - C() + D() + E();
+        return x_above ? A() - B() + D() + E() : C() + E();
+    case BarrierType::DownAndOut:
+        if (call) return x_above ? A() - C() + F() : B() - D() + F();
+        return x_above ? A() - B() + C() - D() + F() : F();
+    case BarrierType::UpAndOut:
+        if (call) return x_above ? F() : A() - B() + C() - D() + F();
+        return x_above ? B() - D() + F() : A() - C() + F();
+    }
+    return 0.0;
+}
+
+} // namespace quant::pricing
@@ -0,0 +1,174 @@
+#include "quant/pricing/BlackScholesBatch.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Parallel.hpp"
+#include "quant/core/Simd.hpp"
+#include "quant/market/VolSurface.hpp"
+#include "quant/market/YieldCurve.hpp"
+
+#include <algorithm>
+
+namespace quant::pricing {
+
+namespace {
+namespace simd = quant::core::simd;
+constexpr std::size_t W = simd::width;
+
+struct Block {
+    const double* spot;
+    const double* strike;
+    const double* maturity;
+    const double* rate;
+    const double* vol;
+    const double* dividend;
+    const double* phi; // +1 call, -1 put
+    double* price;
+    double* delta;
+    double* gamma;
+    double* vega;
+    double* theta;
+    double* rho;
+};
+
+inline void store_masked(double* dst, simd::Mask valid, simd::Vec v) {
+    if (dst) simd::store(dst, simd::select(valid, v, simd::broadcast(0.0)));
+}
+
+template <bool Greeks>
+void evaluate(const Block& b) {
+    using namespace simd;
+    const Vec zero = broadcast(0.0);
+    const Vec one = broadcast(1.0);
+    Vec S = load(b.spot);
+    Vec K = load(b.strike);
+    Vec T = load(b.maturity);
+    Vec r = load(b.rate);
+    Vec sig = load(b.vol);
+    Vec q = load(b.dividend);
+    Vec phi = load(b.phi);
+    Mask valid = (T > zero) & (sig > zero);
+    T = select(valid, T, one);
+    sig = select(valid, sig, one);
+
+    Vec sqrtT = sqrt(T);
+    Vec sd = sig * sqrtT;
+    Vec d1 = fma(r - q + broadcast(0.5) * sig * sig, T, log(S / K)) / sd;
+    Vec d2 = d1 - sd;
+    Vec df = exp(-(r * T));
+    Vec qf = exp(-(q * T));
+    Vec nd1 = norm_cdf(phi * d1);
+    Vec nd2 = norm_cdf(phi * d2);
+    Vec sq = S * qf * nd1;
+    Vec kd = K * df * nd2;
+    store_masked(b.price, valid, phi * (sq - kd));
+    if constexpr (Greeks) {
+        Vec pdf = norm_pdf(d1);
+        Vec sqpdf = S * qf * pdf;
+        store_masked(b.delta, valid, phi * qf * nd1);
+        store_masked(b.gamma, valid, qf * pdf / (S * sd));
+        store_masked(b.vega, valid, sqpdf * sqrtT);
+        store_masked(b.theta, valid, phi * (q * sq - r * kd) - sqpdf * sig / (broadcast(2.0) * sqrtT));
+        store_masked(b.rho, valid, phi * T * kd);
+    }
+}
+
+inline double* offset(std::span<double> s, std::size_t i) { return s.empty() ? nullptr : s.data() + i; }
+
+template <bool Greeks>
+void run(const OptionChainView& c, const BlackScholesBatchOutput& o, std::size_t begin, std::size_t end) {
+    using quant::instruments::OptionType;
+    double phi[W];
+    std::size_t i = begin;
+    for (; i + W <= end; i += W) {
+        for (std::size_t k = 0; k < W; ++k) phi[k] = c.type[i + k] == OptionType::Call ? 1.0 : -1.0;
+        evaluate<Greeks>(Block{c.spot.data() + i, c.strike.data() + i, c.maturity.data() + i, c.rate.data() + i,
+                               c.vol.data() + i, c.dividend.data() + i, phi,
+                               offset(o.price, i), offset(o.delta, i), offset(o.gamma, i),
+                               offset(o.vega, i), offset(o.theta, i), offset(o.rho, i)});
+    }
+    if (i == end) return;
+
+    // Tail: pad to a full vector with a harmless option and copy the live lanes back.
+    std::size_t n = end - i;
+    double s[W], k[W], t[W], r[W], v[W], q[W], res[6][W];
+    std::fill(s, s + W, 1.0);
+    std::fill(k, k + W, 1.0);
+    std::fill(t, t + W, 1.0);
+    std::fill(r, r + W, 0.0);
+    std::fill(v, v + W, 1.0);
+    std::fill(q, q + W, 0.0);
+    std::fill(phi, phi + W, 1.0);
+    for (std::size_t j = 0; j < n; ++j) {
+        s[j] = c.spot[i + j];
+        k[j] = c.strike[i + j];
+        t[j] = c.maturity[i + j];
+        r[j] = c.rate[i + j];
+        v[j] = c.vol[i + j];
+        q[j] = c.dividend[i + j];
+        phi[j] = c.type[i + j] == OptionType::Call ? 1.0 : -1.0;
+    }
+    std::span<double> outs[6] = {o.price, o.delta, o.gamma, o.vega, o.theta, o.rho};
+    auto tmp = [&](int idx) { return outs[idx].empty() ? nullptr : res[idx]; };
+    evaluate<Greeks>(Block{s, k, t, r, v, q, phi, tmp(0), tmp(1), tmp(2), tmp(3), tmp(4), tmp(5)});
+    for (int idx = 0; idx < 6; ++idx) {
+        if (!outs[idx].empty()) std::copy(res[idx], res[idx] + n, outs[idx].data() + i);
+    }
+}
+}
+
+void OptionChain::reserve(std::size_t n) {
+    spot_.reserve(n);
+    strike_.reserve(n);
+    maturity_.reserve(n);
+    rate_.reserve(n);
+    vol_.reserve(n);
+    dividend_.reserve(n);
+    type_.reserve(n);
+}
+
+void OptionChain::push_back(quant::instruments::OptionType type, double spot, double strike, double maturity,
+                            double rate, double vol, double dividend) {
+    spot_.push_back(spot);
+    strike_.push_back(strike);
+    maturity_.push_back(maturity);
+    rate_.push_back(rate);
+    vol_.push_back(vol);
+    dividend_.push_back(dividend);
+    type_.push_back(type);
+}
+
+void OptionChain::push_back(const quant::instruments::EuropeanOption& opt) {
+    const double rate = opt.yield_curve() ? opt.yield_curve()->zero_rate(opt.maturity()) : opt.rate();
+    const double vol = opt.vol_surface() ? opt.vol_surface()->volatility(opt.strike(), opt.maturity())
+                                         : opt.volatility();
+    push_back(opt.option_type(), opt.spot(), opt.strike(), opt.maturity(), rate, vol, opt.dividend());
+}
+
+OptionChainView OptionChain::view() const {
+    return OptionChainView{spot_, strike_, maturity_, rate_, vol_, dividend_, type_};
+}
+
+void BlackScholesBatchEngine::price(const OptionChainView& chain, std::span<double> prices) const {
+    price(chain, BlackScholesBatchOutput{prices, {}, {}, {}, {}, {}});
+}
+
+void BlackScholesBatchEngine::price(const OptionChainView& chain, const BlackScholesBatchOutput& out) const {
+    std::size_t n = chain.size();
+    if (chain.strike.size() != n || chain.maturity.size() != n || chain.rate.size() != n ||
+        chain.vol.size() != n || chain.dividend.size() != n || chain.type.size() != n) {
+        throw quant::core::PricingError("Option chain arrays have mismatched sizes");
+    }
+    for (auto s : {out.price, out.delta, out.gamma, out.vega, out.theta, out.rho}) {
+        if (!s.empty() && s.size() != n) throw quant::core::PricingError("Batch output size mismatch");
+    }
+    bool greeks = !(out.delta.empty() && out.gamma.empty() && out.vega.empty() && out.theta.empty() &&
+                    out.rho.empty());
+    quant::core::parallel_for(n, threads_, min_block_, [&](std::size_t begin, std::size_t end) {
+        if (greeks) {
+            run<true>(chain, out, begin, end);
+        } else {
+            run<false>(chain, out, begin, end);
+        }
+    });
+}
+
+} // namespace quant::pricing
@@ -0,0 +1,29 @@
+#include "quant/pricing/Book.hpp"
+#include "quant/core/Parallel.hpp"
+
+namespace quant::pricing {
+
+namespace {
+constexpr std::size_t kMinBlock = 1024;
+}
+
+void BookPricer::price(const BookGroup<quant::instruments::EuropeanOption>& group, std::span<double> values) const {
+    european_.price(group.chain(), values);
+}
+
+void BookPricer::price(const BookGroup<quant::instruments::BarrierOption>& group, std::span<double> values) const {
+    auto items = group.items();
+    quant::core::parallel_for(items.size(), threads_, kMinBlock, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) values[i] = barrier_.price(items[i]);
+    });
+}
+
+void BookPricer::price(const BookGroup<quant::instruments::VanillaSwap>& group, std::span<double> values) const {
+    auto items = group.items();
+    quant::core::parallel_for(items.size(), threads_, kMinBlock, [&](std::size_t begin, std::size_t end) {
+        // Qualified call: the element type is exact, so skip the virtual dispatch.
+        for (std::size_t i = begin; i < end; ++i) values[i] = items[i].VanillaSwap::npv();
+    });
+}
+
+} // namespace quant::pricing
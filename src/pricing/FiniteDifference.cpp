@@ -0,0 +1,276 @@
+#include "quant/pricing/FiniteDifference.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Tridiagonal.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace quant::pricing {
+
+namespace {
+using quant::instruments::BarrierType;
+using quant::instruments::OptionType;
+
+struct Problem {
+    OptionType type;
+    double spot;
+    double maturity;
+    double rate;
+    double dividend;
+    double vol;
+    bool has_barrier;
+    bool up;
+    bool knock_in;
+    double barrier;
+    double rebate;
+};
+
+// One column of the batched solve: a vanilla payoff at strike, or the rebate paid at expiry if the
+// barrier was never hit. hit is the value on the barrier.
+struct Lane {
+    double strike;
+    bool digital;
+    double hit;
+};
+
+// Sinh grid on [lo, hi] concentrated at centre, with the node nearest spot moved onto spot.
+std::vector<double> make_grid(double lo, double hi, double centre, double spot, std::size_t m, double concentration) {
+    centre = std::clamp(centre, lo, hi);
+    double alpha = concentration * (hi - lo);
+    double c1 = std::asinh((lo - centre) / alpha);
+    double c2 = std::asinh((hi - centre) / alpha);
+    std::vector<double> s(m + 1);
+    for (std::size_t i = 0; i <= m; ++i) {
+        s[i] = centre + alpha * std::sinh(c1 + (c2 - c1) * static_cast<double>(i) / static_cast<double>(m));
+    }
+    s.front() = lo;
+    s.back() = hi;
+    std::size_t j = static_cast<std::size_t>(std::lower_bound(s.begin(), s.end(), spot) - s.begin());
+    if (j > 0 && spot - s[j - 1] < s[j] - spot) --j;
+    s[std::clamp<std::size_t>(j, 1, m - 1)] = spot;
+    return s;
+}
+
+void run(const Problem& p, const FiniteDifferenceSettings& st, const std::vector<Lane>& lanes, double centre,
+         FiniteDifferenceResult* out) {
+    const std::size_t M = st.space_steps;
+    const std::size_t L = lanes.size();
+    const double phi = p.type == OptionType::Call ? 1.0 : -1.0;
+    const double mu = p.rate - p.dividend;
+    const double var = p.vol * p.vol;
+    const bool early = st.exercise != ExerciseStyle::European;
+
+    double max_strike = 0.0;
+    for (const auto& lane : lanes) max_strike = std::max(max_strike, lane.strike);
+    double far_up = std::max(p.spot, max_strike) * std::exp(st.width * p.vol * std::sqrt(p.maturity));
+    double lo = p.has_barrier && !p.up ? p.barrier : 0.0;
+    double hi = p.has_barrier && p.up ? p.barrier : far_up;
+    std::vector<double> S = make_grid(lo, hi, centre, p.spot, M, st.concentration);
+    // The projected solve sweeps back from the end of the grid, so that end must be the exercise
+    // region: descending spot for puts. The three-point formulas below hold for either order.
+    if (phi < 0.0) std::reverse(S.begin(), S.end());
+
+    // L V = 0.5 vol^2 S^2 V_SS + mu S V_S - r V with three-point differences on the non-uniform grid.
+    std::vector<double> a(M + 1, 0.0), b(M + 1, 0.0), c(M + 1, 0.0);
+    for (std::size_t i = 1; i < M; ++i) {
+        double hm = S[i] - S[i - 1], hp = S[i + 1] - S[i];
+        double diff = 0.5 * var * S[i] * S[i], drift = mu * S[i];
+        a[i] = (2.0 * diff - drift * hp) / (hm * (hm + hp));
+        b[i] = (-2.0 * diff + drift * (hp - hm)) / (hm * hp) - p.rate;
+        c[i] = (2.0 * diff + drift * hm) / (hp * (hm + hp));
+    }
+    const double dt = p.maturity / static_cast<double>(st.time_steps);
+    auto factor = [&](double theta, double step) {
+        std::vector<double> lower(M - 1), diag(M - 1), upper(M - 1);
+        for (std::size_t i = 1; i < M; ++i) {
+            lower[i - 1] = -theta * step * a[i];
+            diag[i - 1] = 1.0 - theta * step * b[i];
+            upper[i - 1] = -theta * step * c[i];
+        }
+        quant::core::TridiagonalSolver solver;
+        solver.factor(lower.data(), diag.data(), upper.data(), M - 1);
+        return solver;
+    };
+    const quant::core::TridiagonalSolver implicit = factor(1.0, 0.5 * dt);
+    const quant::core::TridiagonalSolver crank_nicolson = factor(0.5, dt);
+
+    auto payoff = [&](const Lane& lane, double s) {
+        return lane.digital ? p.rebate : std::max(phi * (s - lane.strike), 0.0);
+    };
+    auto boundary = [&](const Lane& lane, double s, double tau) {
+        if (p.has_barrier && s == p.barrier) return lane.hit;
+        double df = std::exp(-p.rate * tau);
+        if (lane.digital) return p.rebate * df; // the far side cannot reach the barrier
+        double v = std::max(phi * (s * std::exp(-p.dividend * tau) - lane.strike * df), 0.0);
+        return early ? std::max(v, payoff(lane, s)) : v;
+    };
+
+    // Values V[i * L + l], interleaved across lanes so every sweep runs over all options at once.
+    std::vector<double> V((M + 1) * L), rhs((M - 1) * L), floor;
+    for (std::size_t i = 0; i <= M; ++i) {
+        for (std::size_t l = 0; l < L; ++l) V[i * L + l] = payoff(lanes[l], S[i]);
+    }
+    for (std::size_t l = 0; l < L; ++l) {
+        V[l] = boundary(lanes[l], S[0], 0.0);
+        V[M * L + l] = boundary(lanes[l], S[M], 0.0);
+    }
+    const bool american = st.exercise == ExerciseStyle::American;
+    if (american) {
+        floor.resize(rhs.size());
+        for (std::size_t i = 1; i < M; ++i) {
+            for (std::size_t l = 0; l < L; ++l) {
+                floor[(i - 1) * L + l] = lanes[l].digital ? -std::numeric_limits<double>::infinity() : payoff(lanes[l], S[i]);
+            }
+        }
+    }
+
+    auto step = [&](const quant::core::TridiagonalSolver& solver, double theta, double h, double tau) {
+        const double ex = (1.0 - theta) * h;
+        for (std::size_t i = 1; i < M; ++i) {
+            const double* v = &V[i * L];
+            double* r = &rhs[(i - 1) * L];
+            for (std::size_t l = 0; l < L; ++l) r[l] = v[l] + ex * (a[i] * v[l - L] + b[i] * v[l] + c[i] * v[l + L]);
+        }
+        for (std::size_t l = 0; l < L; ++l) {
+            V[l] = boundary(lanes[l], S[0], tau);
+            V[M * L + l] = boundary(lanes[l], S[M], tau);
+            rhs[l] += theta * h * a[1] * V[l];
+            rhs[(M - 2) * L + l] += theta * h * c[M - 1] * V[M * L + l];
+        }
+        solver.solve(rhs.data(), L, american ? floor.data() : nullptr);
+        std::copy(rhs.begin(), rhs.end(), V.begin() + static_cast<std::ptrdiff_t>(L));
+    };
+
+    // American exercise is enforced inside each solve; Bermudan dates project the slice.
+    std::vector<char> exercise(st.time_steps + 1, 0);
+    if (st.exercise == ExerciseStyle::Bermudan) {
+        std::size_t dates = std::max<std::size_t>(st.exercise_dates, 1);
+        for (std::size_t d = 1; d < dates; ++d) {
+            double k = static_cast<double>(st.time_steps) * (1.0 - static_cast<double>(d) / static_cast<double>(dates));
+            exercise[static_cast<std::size_t>(std::llround(k))] = 1;
+        }
+    }
+
+    for (std::size_t k = 0; k < st.time_steps; ++k) {
+        double tau = dt * static_cast<double>(k + 1);
+        if (k < st.rannacher_steps) {
+            step(implicit, 1.0, 0.5 * dt, tau - 0.5 * dt);
+            step(implicit, 1.0, 0.5 * dt, tau);
+        } else {
+            step(crank_nicolson, 0.5, dt, tau);
+        }
+        if (!exercise[k + 1]) continue;
+        for (std::size_t i = 1; i < M; ++i) {
+            for (std::size_t l = 0; l < L; ++l) {
+                if (!lanes[l].digital) V[i * L + l] = std::max(V[i * L + l], payoff(lanes[l], S[i]));
+            }
+        }
+    }
+
+    // Greeks at the spot node from the final slice.
+    std::size_t j = static_cast<std::size_t>(std::find(S.begin(), S.end(), p.spot) - S.begin());
+    double hm = S[j] - S[j - 1], hp = S[j + 1] - S[j];
+    for (std::size_t l = 0; l < L; ++l) {
+        double vm = V[(j - 1) * L + l], v0 = V[j * L + l], vp = V[(j + 1) * L + l];
+        FiniteDifferenceResult& r = out[l];
+        r.price = v0;
+        r.delta = (-hp / (hm * (hm + hp))) * vm + ((hp - hm) / (hm * hp)) * v0 + (hm / (hp * (hm + hp))) * vp;
+        r.gamma = 2.0 * (vm / (hm * (hm + hp)) - v0 / (hm * hp) + vp / (hp * (hm + hp)));
+        r.theta = p.rate * v0 - mu * p.spot * r.delta - 0.5 * var * p.spot * p.spot * r.gamma;
+    }
+}
+
+void check(const FiniteDifferenceSettings& s, std::size_t strikes, std::size_t outputs) {
+    if (s.space_steps < 3 || s.time_steps == 0) throw quant::core::PricingError("Finite-difference grid too small");
+    if (strikes != outputs) throw quant::core::PricingError("Finite-difference batch size mismatch");
+}
+
+FiniteDifferenceResult vanilla(const Problem& p, double strike) {
+    BSResult r = black_scholes<BSPrice | BSDelta | BSGamma | BSTheta>(p.type, p.spot, strike, p.maturity, p.rate,
+                                                                     p.dividend, p.vol);
+    return {r.price, r.delta, r.gamma, r.theta};
+}
+}
+
+double FiniteDifferenceEngine::price(const quant::instruments::Instrument& inst) const {
+    if (const auto* opt = dynamic_cast<const quant::instruments::EuropeanOption*>(&inst)) return price(*opt);
+    if (const auto* opt = dynamic_cast<const quant::instruments::BarrierOption*>(&inst)) return price(*opt);
+    throw quant::core::PricingError("Instrument is not EuropeanOption or BarrierOption");
+}
+
+double FiniteDifferenceEngine::price(const quant::instruments::EuropeanOption& opt) const { return solve(opt).price; }
+
+double FiniteDifferenceEngine::price(const quant::instruments::BarrierOption& opt) const { return solve(opt).price; }
+
+FiniteDifferenceResult FiniteDifferenceEngine::solve(const quant::instruments::EuropeanOption& opt) const {
+    FiniteDifferenceResult r;
+    double strike = opt.strike();
+    solve(opt, std::span<const double>(&strike, 1), std::span<FiniteDifferenceResult>(&r, 1));
+    return r;
+}
+
+FiniteDifferenceResult FiniteDifferenceEngine::solve(const quant::instruments::BarrierOption& opt) const {
+    FiniteDifferenceResult r;
+    double strike = opt.strike();
+    solve(opt, std::span<const double>(&strike, 1), std::span<FiniteDifferenceResult>(&r, 1));
+    return r;
+}
+
+void FiniteDifferenceEngine::solve(const quant::instruments::EuropeanOption& base, std::span<const double> strikes,
+                                   std::span<FiniteDifferenceResult> out) const {
+    check(settings_, strikes.size(), out.size());
+    std::fill(out.begin(), out.end(), FiniteDifferenceResult{});
+    if (base.maturity() <= 0.0 || base.volatility() <= 0.0 || strikes.empty()) return;
+    Problem p{base.option_type(), base.spot(), base.maturity(), base.rate(), base.dividend(), base.volatility(),
+              false, false, false, 0.0, 0.0};
+    std::vector<Lane> lanes;
+    lanes.reserve(strikes.size());
+    for (double k : strikes) lanes.push_back({k, false, 0.0});
+    run(p, settings_, lanes, strikes.size() == 1 ? strikes[0] : base.spot(), out.data());
+}
+
+void FiniteDifferenceEngine::solve(const quant::instruments::BarrierOption& base, std::span<const double> strikes,
+                                   std::span<FiniteDifferenceResult> out) const {
+    check(settings_, strikes.size(), out.size());
+    BarrierType type = base.barrier_type();
+    Problem p{base.option_type(), base.spot(), base.maturity(), base.rate(), 0.0, base.volatility(), true,
+              type == BarrierType::UpAndOut || type == BarrierType::UpAndIn,
+              type == BarrierType::UpAndIn || type == BarrierType::DownAndIn, base.barrier(), base.rebate()};
+    if (p.knock_in && settings_.exercise != ExerciseStyle::European) {
+        throw quant::core::PricingError("Finite-difference knock-ins support European exercise only");
+    }
+    if (p.up ? p.spot >= p.barrier : p.spot <= p.barrier) {
+        for (std::size_t i = 0; i < strikes.size(); ++i) {
+            out[i] = p.knock_in ? vanilla(p, strikes[i]) : FiniteDifferenceResult{p.rebate, 0.0, 0.0, 0.0};
+        }
+        return;
+    }
+    std::fill(out.begin(), out.end(), FiniteDifferenceResult{});
+    if (p.maturity <= 0.0 || p.vol <= 0.0 || strikes.empty()) return;
+
+    std::vector<Lane> lanes;
+    lanes.reserve(strikes.size() + 1);
+    for (double k : strikes) lanes.push_back({k, false, p.knock_in ? 0.0 : p.rebate});
+    const bool digital = p.knock_in && p.rebate != 0.0;
+    if (digital) lanes.push_back({0.0, true, 0.0});
+    std::vector<FiniteDifferenceResult> res(lanes.size());
+    run(p, settings_, lanes, strikes.size() == 1 ? strikes[0] : p.spot, res.data());
+
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+        if (!p.knock_in) {
+            out[i] = res[i];
+            continue;
+        }
+        // Knock-in = vanilla - knock-out + rebate paid at expiry if never knocked in.
+        FiniteDifferenceResult v = vanilla(p, strikes[i]);
+        const FiniteDifferenceResult& ko = res[i];
+        FiniteDifferenceResult rb = digital ? res.back() : FiniteDifferenceResult{};
+        out[i] = {v.price - ko.price + rb.price, v.delta - ko.delta + rb.delta, v.gamma - ko.gamma + rb.gamma,
+                  v.theta - ko.theta + rb.theta};
+    }
+}
+
+} // namespace quant::pricing
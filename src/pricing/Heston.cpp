@@ -0,0 +1,350 @@
+#include "quant/pricing/Heston.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Math.hpp"
+#include "quant/core/Optimize.hpp"
+#include "quant/core/Parallel.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+#include <vector>
+
+namespace quant::pricing {
+
+namespace {
+using quant::instruments::OptionType;
+using cplx = std::complex<double>;
+
+constexpr std::size_t kCacheSize = 64; // maturities kept per engine
+constexpr double kPi = 3.14159265358979323846;
+
+cplx log_characteristic_function(const HestonModel& m, cplx u, double T) {
+    const cplx iu{-u.imag(), u.real()};
+    const double s2 = m.sigma() * m.sigma();
+    cplx b = m.kappa() - m.rho() * m.sigma() * iu;
+    cplx d = std::sqrt(b * b + s2 * (iu + u * u));
+    cplx g = (b - d) / (b + d);
+    cplx e = std::exp(-d * T);
+    cplx D = (b - d) / s2 * (1.0 - e) / (1.0 - g * e);
+    cplx C = m.kappa() * m.theta() / s2 * ((b - d) * T - 2.0 * std::log((1.0 - g * e) / (1.0 - g)));
+    return C + D * m.v0();
+}
+
+// Cumulants c1, c2 and c4 of ln(S_T / F) from central differences of the log characteristic function.
+std::array<double, 3> cumulants(const HestonModel& m, double T) {
+    const double h = 1e-3;
+    cplx up = log_characteristic_function(m, h, T);
+    cplx down = log_characteristic_function(m, -h, T);
+    double c1 = (up.imag() - down.imag()) / (2.0 * h);
+    double c2 = std::max(-(up.real() + down.real()) / (h * h), 1e-12);
+    // Even part g(h) = c2 h^2 / 2 - c4 h^4 / 24 + ..., sampled at the scale of the distribution.
+    auto g = [&](double x) {
+        return -0.5 * (log_characteristic_function(m, x, T) + log_characteristic_function(m, -x, T)).real();
+    };
+    double k = 0.2 / std::sqrt(c2);
+    double c4 = -2.0 * (g(2.0 * k) - 4.0 * g(k)) / (k * k * k * k);
+    return {c1, c2, std::isfinite(c4) ? std::fabs(c4) : 0.0};
+}
+
+// Density of y = ln(S_T / F) on [a, b] as a cosine series: coef[k] = Re(phi(w_k) exp(-i w_k a)),
+// w_k = k pi / (b - a), with the k = 0 term halved.
+struct CosSeries {
+    double maturity{0.0};
+    double a{0.0};
+    double b{0.0};
+    std::vector<double> coef;
+};
+
+CosSeries cos_series(const HestonModel& m, double T, const HestonSettings& s) {
+    auto [c1, c2, c4] = cumulants(m, T);
+    const double half_width = s.truncation * std::sqrt(c2 + std::sqrt(c4));
+    CosSeries out;
+    out.maturity = T;
+    out.a = c1 - half_width;
+    out.b = c1 + half_width;
+    out.coef.resize(std::max<std::size_t>(s.cos_terms, 2));
+    const double dw = kPi / (out.b - out.a);
+    for (std::size_t k = 0; k < out.coef.size(); ++k) {
+        double w = dw * static_cast<double>(k);
+        out.coef[k] = std::exp(log_characteristic_function(m, w, T) - cplx(0.0, w * out.a)).real();
+    }
+    out.coef[0] *= 0.5;
+    return out;
+}
+
+// Undiscounted puts E[(K - F e^y)+]. The payoff coefficients are integrated in closed form on
+// [a, min(ln(K / F), b)] and the cosines come from a rotation recurrence instead of trig calls.
+void cos_puts(const CosSeries& s, double F, std::span<const double> strikes, double* puts) {
+    const double width = s.b - s.a;
+    const double dw = kPi / width;
+    const double ea = std::exp(s.a);
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+        double K = strikes[i];
+        double c = K > 0.0 ? std::log(K / F) : s.a;
+        if (c <= s.a) {
+            puts[i] = std::max(K - F, 0.0);
+            continue;
+        }
+        double d = std::min(c, s.b);
+        double ed = std::exp(d);
+        double theta = dw * (d - s.a);
+        double rc = std::cos(theta), rs = std::sin(theta);
+        double cs = 1.0, sn = 0.0;
+        double sum = s.coef[0] * (K * (d - s.a) - F * (ed - ea));
+        for (std::size_t k = 1; k < s.coef.size(); ++k) {
+            double next = cs * rc - sn * rs;
+            sn = sn * rc + cs * rs;
+            cs = next;
+            double w = dw * static_cast<double>(k);
+            double chi = (cs * ed - ea + w * sn * ed) / (1.0 + w * w);
+            double psi = sn / w;
+            sum += s.coef[k] * (K * psi - F * chi);
+        }
+        puts[i] = std::max(2.0 / width * sum, std::max(K - F, 0.0));
+    }
+}
+
+struct GaussLegendre16 {
+    std::array<double, 16> x;
+    std::array<double, 16> w;
+};
+
+// Nodes and weights on [0, 1] from Newton iteration on the Legendre polynomial.
+const GaussLegendre16& gauss_legendre() {
+    static const GaussLegendre16 rule = [] {
+        GaussLegendre16 r{};
+        constexpr int n = 16;
+        for (int i = 0; i < n / 2; ++i) {
+            double z = std::cos(kPi * (i + 0.75) / (n + 0.5));
+            double dp = 0.0;
+            for (int it = 0; it < 100; ++it) {
+                double p0 = 1.0, p1 = 0.0;
+                for (int j = 0; j < n; ++j) {
+                    double p2 = p1;
+                    p1 = p0;
+                    p0 = ((2.0 * j + 1.0) * z * p1 - j * p2) / (j + 1.0);
+                }
+                dp = n * (z * p0 - p1) / (z * z - 1.0);
+                double dz = p0 / dp;
+                z -= dz;
+                if (std::fabs(dz) < 1e-16) break;
+            }
+            double w = 1.0 / ((1.0 - z * z) * dp * dp);
+            r.x[i] = 0.5 * (1.0 - z);
+            r.x[n - 1 - i] = 0.5 * (1.0 + z);
+            r.w[i] = r.w[n - 1 - i] = w;
+        }
+        return r;
+    }();
+    return rule;
+}
+
+// Lewis: call = F - sqrt(F K) / pi * sum_j Re(exp(i u_j X) weight_j), X = ln(F / K), with the
+// quadrature weight and 1 / (u^2 + 1/4) folded into weight_j = w_j phi(u_j - i/2) / (u_j^2 + 1/4).
+struct LewisNodes {
+    double maturity{0.0};
+    std::vector<double> u;
+    std::vector<cplx> weight;
+};
+
+LewisNodes lewis_nodes(const HestonModel& m, double T, const HestonSettings& s) {
+    // Truncate where |phi(u - i/2)| / (u^2 + 1/4) is negligible.
+    double upper = 4.0 / std::sqrt(cumulants(m, T)[1]);
+    while (upper < 1e6 && std::abs(m.characteristic_function(cplx(upper, -0.5), T)) > 1e-15 * (upper * upper + 0.25)) {
+        upper *= 2.0;
+    }
+    // Panels double in width from 1/4, resolving the peak of 1 / (u^2 + 1/4) at the origin, up to
+    // upper / quadrature_panels.
+    const auto& gl = gauss_legendre();
+    const double widest = upper / static_cast<double>(std::max<std::size_t>(s.quadrature_panels, 1));
+    LewisNodes out;
+    out.maturity = T;
+    double left = 0.0, width = std::min(0.25, widest);
+    while (left < upper) {
+        for (std::size_t j = 0; j < 16; ++j) {
+            double u = left + width * gl.x[j];
+            out.u.push_back(u);
+            out.weight.push_back(width * gl.w[j] * m.characteristic_function(cplx(u, -0.5), T) / (u * u + 0.25));
+        }
+        left += width;
+        width = std::min(2.0 * width, widest);
+    }
+    return out;
+}
+
+// Finds the entry for a maturity or builds it outside the lock; the oldest entry is evicted when full.
+template <typename Entry, typename Build>
+std::shared_ptr<const Entry> cached(std::mutex& mutex, std::vector<std::shared_ptr<const Entry>>& entries,
+                                    double maturity, Build&& build) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& e : entries) {
+            if (e->maturity == maturity) return e;
+        }
+    }
+    auto entry = std::make_shared<const Entry>(build());
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& e : entries) {
+        if (e->maturity == maturity) return e;
+    }
+    if (entries.size() >= kCacheSize) entries.erase(entries.begin());
+    entries.push_back(entry);
+    return entry;
+}
+}
+
+struct HestonEngine::Cache {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<const LewisNodes>> lewis; // oldest first
+    std::vector<std::shared_ptr<const CosSeries>> cos;
+};
+
+HestonModel::HestonModel(double v0, double kappa, double theta, double sigma, double rho)
+    : v0_(v0), kappa_(kappa), theta_(theta), sigma_(sigma), rho_(rho) {
+    if (!(v0 >= 0.0) || !(kappa > 0.0) || !(theta >= 0.0) || !(sigma > 0.0) || !(std::fabs(rho) <= 1.0) ||
+        !std::isfinite(v0 + kappa + theta + sigma)) {
+        throw quant::core::DataError("Heston parameters need v0, theta >= 0, kappa, sigma > 0 and |rho| <= 1");
+    }
+}
+
+std::complex<double> HestonModel::characteristic_function(std::complex<double> u, double maturity) const {
+    return std::exp(log_characteristic_function(*this, u, maturity));
+}
+
+HestonEngine::HestonEngine(HestonModel model, HestonSettings settings)
+    : model_(model), settings_(settings), cache_(std::make_shared<Cache>()) {}
+
+double HestonEngine::price(const quant::instruments::Instrument& inst) const {
+    auto opt = dynamic_cast<const quant::instruments::EuropeanOption*>(&inst);
+    if (!opt) throw quant::core::PricingError("Instrument is not EuropeanOption");
+    return price(*opt);
+}
+
+double HestonEngine::price(const quant::instruments::EuropeanOption& opt) const {
+    const double T = opt.maturity();
+    if (T <= 0.0) return 0.0;
+    const double K = opt.strike();
+    const double F = opt.spot() * std::exp((opt.rate() - opt.dividend()) * T);
+    const double df = std::exp(-opt.rate() * T);
+    if (K <= 0.0) return opt.option_type() == OptionType::Call ? df * F : 0.0;
+    auto nodes = cached(cache_->mutex, cache_->lewis, T, [&] { return lewis_nodes(model_, T, settings_); });
+    const double X = std::log(F / K);
+    double sum = 0.0;
+    for (std::size_t j = 0; j < nodes->u.size(); ++j) {
+        double ux = nodes->u[j] * X;
+        sum += std::cos(ux) * nodes->weight[j].real() - std::sin(ux) * nodes->weight[j].imag();
+    }
+    double call = std::max(F - std::sqrt(F * K) / kPi * sum, std::max(F - K, 0.0));
+    double value = opt.option_type() == OptionType::Call ? call : call - (F - K);
+    return df * std::max(value, 0.0);
+}
+
+void HestonEngine::price_strip(OptionType type, double spot, double maturity, double rate, double dividend,
+                               std::span<const double> strikes, std::span<double> prices) const {
+    if (strikes.size() != prices.size()) throw quant::core::PricingError("Heston strip size mismatch");
+    if (maturity <= 0.0) {
+        std::fill(prices.begin(), prices.end(), 0.0);
+        return;
+    }
+    const double F = spot * std::exp((rate - dividend) * maturity);
+    const double df = std::exp(-rate * maturity);
+    auto series = cached(cache_->mutex, cache_->cos, maturity, [&] { return cos_series(model_, maturity, settings_); });
+    cos_puts(*series, F, strikes, prices.data());
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+        double put = prices[i];
+        prices[i] = df * (type == OptionType::Put ? put : put + F - strikes[i]);
+    }
+}
+
+HestonCalibration calibrate_heston(const quant::market::VolSurface& surface, double spot, double rate,
+                                   double dividend, const HestonCalibrationSettings& settings) {
+    if (!(spot > 0.0)) throw quant::core::DataError("Heston calibration needs a positive spot");
+
+    // One entry per expiry: residual_i = scale_i * (model - market) on undiscounted OTM prices.
+    struct Expiry {
+        double maturity, forward;
+        std::size_t offset;
+        std::vector<double> strikes, target, scale;
+    };
+    std::vector<Expiry> expiries;
+    std::size_t m = 0;
+    const auto& K = surface.strikes();
+    const auto& tenors = surface.tenors();
+    for (std::size_t j = 0; j < tenors.size(); ++j) {
+        double T = tenors[j];
+        if (!(T > 0.0)) continue;
+        Expiry e{T, spot * std::exp((rate - dividend) * T), m, {}, {}, {}};
+        double df = std::exp(-rate * T);
+        for (std::size_t i = 0; i < K.size(); ++i) {
+            double vol = surface.vol(i, j);
+            if (!(K[i] > 0.0) || !(vol > 0.0)) continue;
+            OptionType type = K[i] < e.forward ? OptionType::Put : OptionType::Call;
+            auto bs = black_scholes<BSPrice | BSVega>(type, spot, K[i], T, rate, dividend, vol);
+            e.strikes.push_back(K[i]);
+            e.target.push_back(bs.price / df);
+            e.scale.push_back(df / std::max(bs.vega, 1e-3 * spot * std::sqrt(T)));
+        }
+        m += e.strikes.size();
+        if (!e.strikes.empty()) expiries.push_back(std::move(e));
+    }
+    if (m < 5) throw quant::core::DataError("Heston calibration needs at least five surface quotes");
+
+    HestonModel start = settings.initial.value_or([&] {
+        const Expiry& mid = expiries[expiries.size() / 2];
+        std::size_t atm = 0;
+        for (std::size_t i = 1; i < K.size(); ++i) {
+            if (std::fabs(K[i] - spot) < std::fabs(K[atm] - spot)) atm = i;
+        }
+        double vol = surface.volatility(K[atm], mid.maturity);
+        return HestonModel(vol * vol, 1.5, vol * vol, 0.5, -0.5);
+    }());
+    // alpha = exp(x) for the positive parameters and rho = tanh(x4), clamped to stay representable.
+    auto model_at = [](const std::array<double, 5>& x) {
+        auto pos = [](double v) { return std::exp(std::clamp(v, -30.0, 30.0)); };
+        return HestonModel(pos(x[0]), pos(x[1]), pos(x[2]), pos(x[3]), std::tanh(std::clamp(x[4], -15.0, 15.0)));
+    };
+    std::array<double, 5> x{std::log(std::max(start.v0(), 1e-8)), std::log(start.kappa()),
+                            std::log(std::max(start.theta(), 1e-8)), std::log(start.sigma()),
+                            std::atanh(std::clamp(start.rho(), -0.999, 0.999))};
+
+    const HestonSettings& pricing = settings.pricing;
+    auto residuals = [&](const HestonModel& model, const Expiry& e, double* puts, double* out) {
+        cos_puts(cos_series(model, e.maturity, pricing), e.forward, e.strikes, puts);
+        for (std::size_t i = 0; i < e.strikes.size(); ++i) {
+            double otm = e.strikes[i] < e.forward ? puts[i] : puts[i] + e.forward - e.strikes[i];
+            out[i] = e.scale[i] * (otm - e.target[i]);
+        }
+    };
+    // Forward-difference Jacobian; each expiry's strip and its five bumps run on one thread.
+    auto problem = [&](const std::array<double, 5>& xs, double* r, double* J) {
+        const HestonModel model = model_at(xs);
+        quant::core::parallel_for(expiries.size(), settings.threads, 1, [&](std::size_t begin, std::size_t end) {
+            std::vector<double> puts, bumped;
+            for (std::size_t k = begin; k < end; ++k) {
+                const Expiry& e = expiries[k];
+                const std::size_t n = e.strikes.size();
+                puts.resize(n);
+                bumped.resize(n);
+                residuals(model, e, puts.data(), r + e.offset);
+                if (!J) continue;
+                for (std::size_t p = 0; p < 5; ++p) {
+                    auto xp = xs;
+                    const double h = 1e-6 * std::max(1.0, std::fabs(xs[p]));
+                    xp[p] += h;
+                    residuals(model_at(xp), e, puts.data(), bumped.data());
+                    for (std::size_t i = 0; i < n; ++i) J[(e.offset + i) * 5 + p] = (bumped[i] - r[e.offset + i]) / h;
+                }
+            }
+        });
+    };
+
+    quant::core::LevenbergMarquardtSettings lm;
+    lm.max_iterations = settings.max_iterations;
+    lm.tolerance = settings.tolerance;
+    auto res = quant::core::levenberg_marquardt<5>(problem, x, m, lm);
+    return {model_at(x), std::sqrt(2.0 * res.cost / static_cast<double>(m)), res.iterations, res.converged};
+}
+
+} // namespace quant::pricing
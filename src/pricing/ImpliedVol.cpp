@@ -0,0 +1,158 @@
+#include "quant/pricing/ImpliedVol.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Math.hpp"
+#include "quant/core/Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace quant::pricing {
+
+namespace {
+constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+// Undiscounted Black call price divided by sqrt(F K), x = ln(F/K) <= 0, s = vol * sqrt(T).
+inline double normalised_call(double x, double s) {
+    if (s <= 0.0) return 0.0;
+    double h = x / s;
+    double t = 0.5 * s;
+    return std::exp(0.5 * x) * quant::core::norm_cdf(h + t) - std::exp(-0.5 * x) * quant::core::norm_cdf(h - t);
+}
+
+inline double normalised_vega(double x, double s) {
+    return quant::core::INV_SQRT_2PI * std::exp(-0.5 * (x * x / (s * s) + 0.25 * s * s));
+}
+
+// Solves normalised_call(x, s) = beta for s, given x <= 0 and 0 < beta < exp(x / 2).
+double normalised_implied_vol(double beta, double x, double tolerance, std::size_t max_iterations) {
+    double ax = std::fabs(x);
+    double b_max = std::exp(0.5 * x);
+    // b(s) is convex below the inflection point s_c and concave above it.
+    double s_c = std::sqrt(2.0 * ax);
+    double b_c = normalised_call(x, s_c);
+    bool lower = beta < b_c;
+
+    double s = 0.0;
+    if (lower) {
+        // ln b ~ A - x^2 / (2 s^2), pinned at the inflection point.
+        double a = std::log(b_c) + 0.25 * ax;
+        s = ax / std::sqrt(2.0 * (a - std::log(beta)));
+    } else {
+        // b ~ b_max - (b_max + 1 / b_max) N(-s / 2) for large s; exact at the money.
+        double u = (b_max - beta) / (b_max + 1.0 / b_max);
+        s = std::max(s_c, -2.0 * quant::core::inverse_norm_cdf(u));
+    }
+
+    double lo = 0.0;
+    double hi = std::numeric_limits<double>::infinity();
+    for (std::size_t it = 0; it < max_iterations; ++it) {
+        double b = normalised_call(x, s);
+        double v = normalised_vega(x, s);
+        if (b > beta) {
+            hi = std::min(hi, s);
+        } else {
+            lo = std::max(lo, s);
+        }
+        // Ratios b''/b' and b'''/b' of the normalised Black function.
+        double s2 = s * s;
+        double h2 = x * x / (s2 * s) - 0.25 * s;
+        double h3 = h2 * h2 - 3.0 * x * x / (s2 * s2) - 0.25;
+        double nu = 0.0, gamma = 0.0, delta = 0.0;
+        if (lower) {
+            // Objective 1/ln b - 1/ln beta is close to linear on the lower branch.
+            double l = std::log(b);
+            double l1 = v / b;
+            double l2 = l1 * (h2 - l1);
+            double l3 = l1 * (h3 - 3.0 * l1 * h2 + 2.0 * l1 * l1);
+            double g1 = -l1 / (l * l);
+            double g2 = (2.0 * l1 * l1 / l - l2) / (l * l);
+            double g3 = (6.0 * l1 * l2 / l - 6.0 * l1 * l1 * l1 / (l * l) - l3) / (l * l);
+            nu = -(1.0 / l - 1.0 / std::log(beta)) / g1;
+            gamma = g2 / g1;
+            delta = g3 / g1;
+        } else {
+            nu = -(b - beta) / v;
+            gamma = h2;
+            delta = h3;
+        }
+        double step = nu * (1.0 + 0.5 * gamma * nu) / (1.0 + nu * (gamma + delta * nu / 6.0));
+        if (!std::isfinite(step)) step = nu;
+        if (std::fabs(step) <= tolerance * s) return s + step;
+        double next = s + step;
+        if (!std::isfinite(next) || next <= lo || next >= hi) {
+            next = std::isfinite(hi) ? 0.5 * (lo + hi) : 2.0 * std::max(s, lo);
+        }
+        s = next;
+    }
+    return s;
+}
+}
+
+double ImpliedVolSolver::solve(quant::instruments::OptionType type, double price, double spot, double strike,
+                               double maturity, double rate, double dividend) const {
+    if (!(maturity > 0.0) || !(spot > 0.0) || !(strike > 0.0) || !std::isfinite(price)) return NaN;
+    double df = std::exp(-rate * maturity);
+    double forward = spot * std::exp((rate - dividend) * maturity);
+    double x = std::log(forward / strike);
+    double beta = price / (df * std::sqrt(forward * strike));
+    // Reduce to the out-of-the-money option via put-call parity, then to a call with x <= 0.
+    double theta = type == quant::instruments::OptionType::Call ? 1.0 : -1.0;
+    if (theta * x > 0.0) beta -= theta * (std::exp(0.5 * x) - std::exp(-0.5 * x));
+    x = -std::fabs(x);
+    if (beta <= 0.0) return beta > -1e-12 ? 0.0 : NaN;
+    if (beta >= std::exp(0.5 * x)) return NaN;
+    return normalised_implied_vol(beta, x, tolerance_, max_iterations_) / std::sqrt(maturity);
+}
+
+double ImpliedVolSolver::solve(const quant::instruments::EuropeanOption& opt, double price) const {
+    return solve(opt.option_type(), price, opt.spot(), opt.strike(), opt.maturity(), opt.rate(), opt.dividend());
+}
+
+void ImpliedVolSolver::solve(const OptionChainView& chain, std::span<const double> prices,
+                             std::span<double> vols) const {
+    std::size_t n = chain.size();
+    if (prices.size() != n || vols.size() != n || chain.strike.size() != n || chain.maturity.size() != n ||
+        chain.rate.size() != n || chain.dividend.size() != n || chain.type.size() != n) {
+        throw quant::core::PricingError("Implied vol batch size mismatch");
+    }
+    quant::core::parallel_for(n, threads_, 1024, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            vols[i] = solve(chain.type[i], prices[i], chain.spot[i], chain.strike[i], chain.maturity[i],
+                            chain.rate[i], chain.dividend[i]);
+        }
+    });
+}
+
+quant::market::VolSurface implied_vol_surface(std::vector<double> strikes, std::vector<double> tenors,
+                                              const std::vector<std::vector<double>>& prices,
+                                              quant::instruments::OptionType type, double spot, double rate,
+                                              double dividend, const ImpliedVolSolver& solver) {
+    if (prices.size() != strikes.size()) throw quant::core::DataError("Price grid size mismatch (strikes)");
+    OptionChain chain;
+    chain.reserve(strikes.size() * tenors.size());
+    std::vector<double> flat;
+    flat.reserve(strikes.size() * tenors.size());
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+        if (prices[i].size() != tenors.size()) throw quant::core::DataError("Price grid size mismatch (tenors)");
+        for (std::size_t j = 0; j < tenors.size(); ++j) {
+            chain.push_back(type, spot, strikes[i], tenors[j], rate, 0.0, dividend);
+            flat.push_back(prices[i][j]);
+        }
+    }
+    std::vector<double> vols(flat.size());
+    solver.solve(chain.view(), flat, vols);
+
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+        for (std::size_t j = 0; j < tenors.size(); ++j) {
+            if (std::isnan(vols[i * tenors.size() + j])) {
+                throw quant::core::DataError("No implied vol for quote at strike " + std::to_string(strikes[i]) +
+                                             ", tenor " + std::to_string(tenors[j]));
+            }
+        }
+    }
+    return quant::market::VolSurface(std::move(strikes), std::move(tenors), std::move(vols));
+}
+
+} // namespace quant::pricing
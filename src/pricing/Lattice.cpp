@@ -0,0 +1,266 @@
+#include "quant/pricing/Lattice.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/pricing/BarrierOption.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace quant::pricing {
+
+namespace {
+using quant::instruments::BarrierType;
+using quant::instruments::OptionType;
+
+struct Problem {
+    OptionType type;
+    double spot;
+    double strike;
+    double maturity;
+    double rate;
+    double dividend;
+    double vol;
+    bool has_barrier;
+    bool up;
+    bool knock_in;
+    double barrier;
+    double rebate;
+};
+
+struct Geometry {
+    std::size_t steps;
+    bool trinomial;
+    double dt;
+    double dx;
+    double pu;
+    double pm;
+    double pd;
+    long barrier; // barrier layer in units of dx from spot (at or beyond the barrier)
+    double weight; // < 1 when the barrier falls between layers: weight of the layer beyond it
+};
+
+constexpr double kMaxAlignedSteps = 8.0;
+
+// Barrier at log distance log_h between layers: the layer at or beyond it, weighted by how close
+// the barrier is to it (Derman-Kani-Ergener-Bardhan interpolation with the layer inside).
+void straddle(Geometry& g, double log_h) {
+    const double x = log_h / g.dx;
+    g.barrier = static_cast<long>(std::max(1.0, std::ceil(x)));
+    g.weight = x - static_cast<double>(g.barrier - 1);
+}
+
+Geometry make_geometry(const Problem& p, LatticeType type, std::size_t steps) {
+    const double nu = p.rate - p.dividend - 0.5 * p.vol * p.vol;
+    const double log_h = p.has_barrier ? std::fabs(std::log(p.barrier / p.spot)) : 0.0;
+    Geometry g{steps, type == LatticeType::Trinomial, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 1.0};
+    // Aligning a layer with a barrier very close to spot takes about vol^2 T / L^2 steps. Past
+    // kMaxAlignedSteps times the requested count, keep the requested steps and interpolate between
+    // the layers either side of the barrier instead.
+    const double f = p.has_barrier ? p.vol * p.vol * p.maturity / (log_h * log_h) : 0.0;
+    const double cap = kMaxAlignedSteps * static_cast<double>(steps);
+    const bool aligned = p.has_barrier && (g.trinomial ? 3.0 * f : f) <= cap;
+
+    if (!g.trinomial) {
+        if (aligned) {
+            // Boyle-Lau: N = floor(m^2 vol^2 T / L^2) puts layer m at or just beyond the barrier.
+            double m = std::max(1.0, std::round(std::sqrt(static_cast<double>(steps) / f)));
+            g.steps = std::max<std::size_t>(1, static_cast<std::size_t>(std::floor(m * m * f)));
+            g.barrier = static_cast<long>(m);
+        }
+        g.dt = p.maturity / static_cast<double>(g.steps);
+        g.dx = p.vol * std::sqrt(g.dt);
+        if (p.has_barrier && !aligned) straddle(g, log_h);
+        double growth = std::exp((p.rate - p.dividend) * g.dt);
+        g.pu = (growth - std::exp(-g.dx)) / (std::exp(g.dx) - std::exp(-g.dx));
+        g.pd = 1.0 - g.pu;
+    } else {
+        // Target dx = vol sqrt(3 dt); with a barrier take the nearest spacing that divides L.
+        if (aligned) g.steps = std::max(g.steps, static_cast<std::size_t>(std::ceil(3.0 * f)));
+        g.dt = p.maturity / static_cast<double>(g.steps);
+        g.dx = p.vol * std::sqrt(3.0 * g.dt);
+        if (p.has_barrier && !aligned) {
+            straddle(g, log_h);
+        } else if (p.has_barrier) {
+            double n = std::max(1.0, std::round(log_h / g.dx));
+            // Keep the middle probability non-negative: dx^2 >= vol^2 dt + nu^2 dt^2.
+            double min_dx = std::sqrt(p.vol * p.vol * g.dt + nu * nu * g.dt * g.dt);
+            if (n > 1.0 && log_h / n < min_dx) n -= 1.0;
+            g.dx = log_h / n;
+            g.barrier = static_cast<long>(n);
+        }
+        double var = (p.vol * p.vol * g.dt + nu * nu * g.dt * g.dt) / (g.dx * g.dx);
+        double mean = nu * g.dt / g.dx;
+        g.pu = 0.5 * (var + mean);
+        g.pd = 0.5 * (var - mean);
+        g.pm = 1.0 - var;
+    }
+    if (!p.up) g.barrier = -g.barrier;
+    if (g.pu < 0.0 || g.pd < 0.0 || g.pm < 0.0 || g.pu > 1.0 || g.pd > 1.0) {
+        throw quant::core::PricingError("Lattice probabilities out of range; increase the number of steps");
+    }
+    return g;
+}
+
+enum class Payoff { Vanilla, Rebate };
+
+// Rolls back one payoff; nodes on or beyond the barrier are worth hit_value when knock_out is set.
+double roll_back(const Problem& p, const LatticeSettings& s, const Geometry& g, Payoff payoff, bool knock_out,
+                 double hit_value) {
+    const std::size_t N = g.steps;
+    const double phi = p.type == OptionType::Call ? 1.0 : -1.0;
+    const double disc = std::exp(-p.rate * g.dt);
+    const double qu = disc * g.pu, qm = disc * g.pm, qd = disc * g.pd;
+    const bool trinomial = g.trinomial;
+    // Ladder index of node i at step n is (N - n) + stride * i.
+    const std::size_t stride = trinomial ? 1 : 2;
+    auto nodes = [&](std::size_t n) { return trinomial ? 2 * n + 1 : n + 1; };
+
+    std::vector<double> ladder(2 * N + 1);
+    ladder[N] = p.spot;
+    const double up = std::exp(g.dx);
+    const double down = std::exp(-g.dx);
+    for (std::size_t k = 1; k <= N; ++k) {
+        ladder[N + k] = ladder[N + k - 1] * up;
+        ladder[N - k] = ladder[N - k + 1] * down;
+    }
+    // First ladder index that is knocked out, from below (up barrier) or above (down barrier).
+    const bool barrier = knock_out && p.has_barrier;
+    const long hit = static_cast<long>(N) + g.barrier;
+    auto knocked = [&](std::size_t k) {
+        return barrier && (p.up ? static_cast<long>(k) >= hit : static_cast<long>(k) <= hit);
+    };
+
+    std::vector<char> exercise(N + 1, 0);
+    if (s.exercise == ExerciseStyle::American) {
+        std::fill(exercise.begin(), exercise.end(), 1);
+    } else if (s.exercise == ExerciseStyle::Bermudan) {
+        std::size_t dates = std::max<std::size_t>(s.exercise_dates, 1);
+        for (std::size_t d = 1; d <= dates; ++d) {
+            exercise[static_cast<std::size_t>(std::llround(static_cast<double>(N * d) / static_cast<double>(dates)))] = 1;
+        }
+    }
+    const bool early = s.exercise != ExerciseStyle::European && payoff == Payoff::Vanilla;
+    auto intrinsic = [&](double spot) { return std::max(phi * (spot - p.strike), 0.0); };
+
+    std::vector<double> v(nodes(N));
+    std::size_t start = N;
+    if (s.smoothing && payoff == Payoff::Vanilla && N > 1) {
+        // One closed-form step replaces the kink of the payoff at the strike; knock-outs use the
+        // barrier formula so the last step keeps its crossing probability.
+        start = N - 1;
+        const BarrierType ko = p.up ? BarrierType::UpAndOut : BarrierType::DownAndOut;
+        const AnalyticBarrierEngine last_step;
+        for (std::size_t i = 0; i < nodes(start); ++i) {
+            std::size_t k = (N - start) + stride * i;
+            double cont =
+                barrier ? last_step.price(quant::instruments::BarrierOption(ko, p.type, ladder[k], p.strike, g.dt, p.rate,
+                                                                            p.vol, p.barrier, hit_value))
+                        : black_scholes<BSPrice>(p.type, ladder[k], p.strike, g.dt, p.rate, p.dividend, p.vol).price;
+            v[i] = knocked(k) ? hit_value : (early && exercise[start] ? std::max(cont, intrinsic(ladder[k])) : cont);
+        }
+    } else {
+        for (std::size_t i = 0; i < nodes(N); ++i) {
+            std::size_t k = stride * i;
+            v[i] = knocked(k) ? hit_value : (payoff == Payoff::Vanilla ? intrinsic(ladder[k]) : p.rebate);
+        }
+    }
+
+    for (std::size_t n = start; n-- > 0;) {
+        const std::size_t base = N - n;
+        const std::size_t count = nodes(n);
+        // Live nodes are [lo, hi); nodes outside are on or beyond the barrier.
+        std::size_t lo = 0, hi = count;
+        if (barrier) {
+            long first = hit - static_cast<long>(base);
+            if (p.up) {
+                long i = first <= 0 ? 0 : (first + static_cast<long>(stride) - 1) / static_cast<long>(stride);
+                hi = std::min(count, static_cast<std::size_t>(i));
+            } else {
+                long i = first < 0 ? -1 : first / static_cast<long>(stride);
+                lo = std::min(count, static_cast<std::size_t>(i + 1));
+            }
+            hi = std::max(hi, lo);
+        }
+        // In place: node i reads old values i..i+2, none of which has been overwritten yet.
+        if (trinomial) {
+            for (std::size_t i = lo; i < hi; ++i) v[i] = qd * v[i] + qm * v[i + 1] + qu * v[i + 2];
+        } else {
+            for (std::size_t i = lo; i < hi; ++i) v[i] = qd * v[i] + qu * v[i + 1];
+        }
+        if (early && exercise[n]) {
+            for (std::size_t i = lo; i < hi; ++i) v[i] = std::max(v[i], intrinsic(ladder[base + stride * i]));
+        }
+        std::fill(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(lo), hit_value);
+        std::fill(v.begin() + static_cast<std::ptrdiff_t>(hi), v.begin() + static_cast<std::ptrdiff_t>(count),
+                  hit_value);
+    }
+    return v[0];
+}
+
+// Barrier value on one geometry: knock-out directly, knock-in by parity.
+double barrier_price(const Problem& p, const LatticeSettings& s, const Geometry& g) {
+    if (!p.knock_in) return roll_back(p, s, g, Payoff::Vanilla, true, p.rebate);
+    // Knock-in = vanilla - knock-out on the same nodes, plus the rebate if never knocked in.
+    double in = roll_back(p, s, g, Payoff::Vanilla, false, 0.0) - roll_back(p, s, g, Payoff::Vanilla, true, 0.0);
+    if (p.rebate != 0.0) in += roll_back(p, s, g, Payoff::Rebate, true, 0.0);
+    return in;
+}
+
+// Price on one lattice and the step count actually used.
+std::pair<double, std::size_t> lattice_price(const Problem& p, const LatticeSettings& s, std::size_t steps) {
+    Geometry g = make_geometry(p, s.type, steps);
+    if (!p.has_barrier) return {roll_back(p, s, g, Payoff::Vanilla, false, 0.0), g.steps};
+    double value = barrier_price(p, s, g);
+    if (g.weight < 1.0) {
+        Geometry inside = g;
+        inside.barrier += p.up ? -1 : 1;
+        value = g.weight * value + (1.0 - g.weight) * barrier_price(p, s, inside);
+    }
+    return {value, g.steps};
+}
+
+double solve(Problem p, const LatticeSettings& s) {
+    if (s.steps == 0) throw quant::core::PricingError("Lattice needs at least one time step");
+    if (p.has_barrier) {
+        if (p.knock_in && s.exercise != ExerciseStyle::European) {
+            throw quant::core::PricingError("Lattice knock-ins support European exercise only");
+        }
+        if (p.up ? p.spot >= p.barrier : p.spot <= p.barrier) {
+            if (!p.knock_in) return p.rebate;
+            p.has_barrier = false;
+        }
+    }
+    if (p.maturity <= 0.0 || p.vol <= 0.0) return 0.0;
+
+    auto [fine, n_fine] = lattice_price(p, s, s.steps);
+    if (!s.richardson || s.steps < 2) return fine;
+    auto [coarse, n_coarse] = lattice_price(p, s, s.steps / 2);
+    if (n_fine == n_coarse) return fine;
+    // Error ~ c / N: eliminate c using the step counts actually used.
+    double a = static_cast<double>(n_fine), b = static_cast<double>(n_coarse);
+    return (a * fine - b * coarse) / (a - b);
+}
+}
+
+double LatticeEngine::price(const quant::instruments::Instrument& inst) const {
+    if (const auto* opt = dynamic_cast<const quant::instruments::EuropeanOption*>(&inst)) return price(*opt);
+    if (const auto* opt = dynamic_cast<const quant::instruments::BarrierOption*>(&inst)) return price(*opt);
+    throw quant::core::PricingError("Instrument is not EuropeanOption or BarrierOption");
+}
+
+double LatticeEngine::price(const quant::instruments::EuropeanOption& opt) const {
+    Problem p{opt.option_type(), opt.spot(), opt.strike(), opt.maturity(), opt.rate(), opt.dividend(),
+              opt.volatility(), false, false, false, 0.0, 0.0};
+    return solve(p, settings_);
+}
+
+double LatticeEngine::price(const quant::instruments::BarrierOption& opt) const {
+    BarrierType type = opt.barrier_type();
+    Problem p{opt.option_type(), opt.spot(), opt.strike(), opt.maturity(), opt.rate(), 0.0, opt.volatility(), true,
+              type == BarrierType::UpAndOut || type == BarrierType::UpAndIn,
+              type == BarrierType::UpAndIn || type == BarrierType::DownAndIn, opt.barrier(), opt.rebate()};
+    return solve(p, settings_);
+}
+
+} // namespace quant::pricing
@@ -0,0 +1,234 @@
+#include "quant/pricing/MonteCarlo.hpp"
+#include "quant/core/BrownianBridge.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Parallel.hpp"
+#include "quant/core/Random.hpp"
+#include "quant/core/Sobol.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <vector>
+
+namespace quant::pricing {
+
+namespace {
+using quant::instruments::BarrierType;
+using quant::instruments::OptionType;
+
+constexpr std::size_t kBlock = 256; // samples (paths or antithetic pairs) per block
+
+struct Product {
+    OptionType type;
+    double spot;
+    double strike;
+    double maturity;
+    double rate;
+    double dividend;
+    double vol;
+    bool has_barrier;
+    BarrierType barrier_type;
+    double barrier;
+    double rebate;
+    double control_mean;
+    std::size_t steps;
+};
+
+struct Moments {
+    double sy{0.0};
+    double syy{0.0};
+    double sx{0.0};
+    double sxx{0.0};
+    double sxy{0.0};
+};
+
+// Gaussian draws for a block of samples, step-major: z[k * count + j] drives step k of sample j.
+struct NormalSource {
+    quant::core::PhiloxNormals rng;
+    std::optional<quant::core::SobolSequence> sobol;
+    std::optional<quant::core::BrownianBridge> bridge;
+    std::size_t steps;
+
+    NormalSource(const MonteCarloSettings& s, std::size_t steps) : rng(s.seed), steps(steps) {
+        if (s.generator == PathGenerator::PseudoRandom) return;
+        sobol.emplace(std::min(steps, quant::core::SobolSequence::max_dimension()), true, s.seed);
+        if (s.generator == PathGenerator::SobolBrownianBridge) bridge.emplace(steps);
+    }
+
+    // row and path are scratch buffers of length steps.
+    void fill(std::size_t first, std::size_t count, double* z, double* row, double* path) const {
+        if (!sobol) {
+            for (std::size_t j = 0; j < count; ++j) {
+                for (std::size_t k = 0; k < steps; k += 2) {
+                    auto pair = rng.pair(first + j, static_cast<std::uint32_t>(k / 2));
+                    z[k * count + j] = pair[0];
+                    if (k + 1 < steps) z[(k + 1) * count + j] = pair[1];
+                }
+            }
+            return;
+        }
+        const std::size_t dim = sobol->dimension();
+        auto cursor = sobol->cursor(first);
+        for (std::size_t j = 0; j < count; ++j) {
+            cursor.next(row);
+            for (std::size_t k = 0; k < dim; ++k) row[k] = quant::core::inverse_norm_cdf(row[k]);
+            for (std::size_t k = dim & ~std::size_t{1}; k < steps; k += 2) {
+                auto pair = rng.pair(first + j, static_cast<std::uint32_t>(k / 2));
+                if (k >= dim) row[k] = pair[0];
+                if (k + 1 < steps) row[k + 1] = pair[1];
+            }
+            const double* draws = row;
+            if (bridge) {
+                bridge->transform(row, path);
+                draws = path;
+            }
+            for (std::size_t k = 0; k < steps; ++k) z[k * count + j] = draws[k];
+        }
+    }
+};
+
+void simulate_block(const Product& p, const MonteCarloSettings& s, const double* z, std::size_t count, Moments& m) {
+    const bool anti = s.antithetic;
+    const std::size_t lanes = anti ? 2 * count : count;
+    const double dt = p.maturity / static_cast<double>(p.steps);
+    const double drift = (p.rate - p.dividend - 0.5 * p.vol * p.vol) * dt;
+    const double diffusion = p.vol * std::sqrt(dt);
+    const double disc_T = std::exp(-p.rate * p.maturity);
+    const double phi = p.type == OptionType::Call ? 1.0 : -1.0;
+    const bool up = p.barrier_type == BarrierType::UpAndOut || p.barrier_type == BarrierType::UpAndIn;
+    const bool knock_out = p.barrier_type == BarrierType::UpAndOut || p.barrier_type == BarrierType::DownAndOut;
+    const bool bridge = s.monitoring == BarrierMonitoring::Continuous;
+    const double log_h = p.has_barrier ? std::log(p.barrier) : 0.0;
+    const double bridge_scale = 2.0 / (p.vol * p.vol * dt);
+    auto crossed = [&](double x) { return up ? x >= log_h : x <= log_h; };
+
+    // Structure-of-arrays path state: log spot, survival probability, accrued rebate PV.
+    double x[2 * kBlock], w[2 * kBlock], reb[2 * kBlock];
+    const double x0 = std::log(p.spot);
+    const double w0 = (p.has_barrier && crossed(x0)) ? 0.0 : 1.0;
+    std::fill(x, x + lanes, x0);
+    std::fill(w, w + lanes, w0);
+    std::fill(reb, reb + lanes, (knock_out && w0 == 0.0) ? p.rebate : 0.0);
+
+    for (std::size_t k = 0; k < p.steps; ++k) {
+        const double disc_k = std::exp(-p.rate * dt * static_cast<double>(k + 1));
+        const double* z_k = z + k * count;
+        for (std::size_t j = 0; j < count; ++j) {
+            for (std::size_t a = 0; a < (anti ? 2u : 1u); ++a) {
+                std::size_t lane = j + a * count;
+                double prev = x[lane];
+                double next = prev + drift + (a == 0 ? diffusion : -diffusion) * z_k[j];
+                x[lane] = next;
+                if (!p.has_barrier || w[lane] == 0.0) continue;
+                double w_new = w[lane];
+                if (crossed(next)) {
+                    w_new = 0.0;
+                } else if (bridge) {
+                    w_new *= 1.0 - std::exp(-bridge_scale * (log_h - prev) * (log_h - next));
+                }
+                if (knock_out) reb[lane] += p.rebate * disc_k * (w[lane] - w_new);
+                w[lane] = w_new;
+            }
+        }
+    }
+
+    for (std::size_t j = 0; j < count; ++j) {
+        double y = 0.0, c = 0.0;
+        for (std::size_t a = 0; a < (anti ? 2u : 1u); ++a) {
+            std::size_t lane = j + a * count;
+            double spot_T = std::exp(x[lane]);
+            double vanilla = std::max(phi * (spot_T - p.strike), 0.0) * disc_T;
+            if (!p.has_barrier) {
+                y += vanilla;
+                c += spot_T * disc_T;
+            } else {
+                y += knock_out ? w[lane] * vanilla + reb[lane] : (1.0 - w[lane]) * vanilla + w[lane] * p.rebate * disc_T;
+                c += vanilla;
+            }
+        }
+        if (anti) {
+            y *= 0.5;
+            c *= 0.5;
+        }
+        m.sy += y;
+        m.syy += y * y;
+        m.sx += c;
+        m.sxx += c * c;
+        m.sxy += c * y;
+    }
+}
+
+MonteCarloResult run(const Product& p, const MonteCarloSettings& s) {
+    if (s.paths == 0) throw quant::core::PricingError("Monte Carlo needs at least one path");
+    if (p.steps == 0) throw quant::core::PricingError("Monte Carlo needs at least one time step");
+    if (p.maturity <= 0.0 || p.vol <= 0.0) return {};
+
+    std::size_t samples = s.antithetic ? (s.paths + 1) / 2 : s.paths;
+    std::size_t blocks = (samples + kBlock - 1) / kBlock;
+    std::vector<Moments> partial(blocks);
+    const NormalSource normals(s, p.steps);
+    quant::core::parallel_for(blocks, s.threads, 1, [&](std::size_t b0, std::size_t b1) {
+        std::vector<double> z(kBlock * p.steps), row(p.steps), path(p.steps);
+        for (std::size_t b = b0; b < b1; ++b) {
+            std::size_t first = b * kBlock;
+            std::size_t count = std::min(kBlock, samples - first);
+            normals.fill(first, count, z.data(), row.data(), path.data());
+            simulate_block(p, s, z.data(), count, partial[b]);
+        }
+    });
+
+    // Reduce in block order so the sum does not depend on the thread split.
+    Moments t;
+    for (const auto& m : partial) {
+        t.sy += m.sy;
+        t.syy += m.syy;
+        t.sx += m.sx;
+        t.sxx += m.sxx;
+        t.sxy += m.sxy;
+    }
+    double n = static_cast<double>(samples);
+    double mean_y = t.sy / n;
+    double var_y = samples > 1 ? (t.syy - n * mean_y * mean_y) / (n - 1.0) : 0.0;
+    double price = mean_y;
+    double var = var_y;
+    if (s.control_variate && samples > 1) {
+        double mean_x = t.sx / n;
+        double var_x = (t.sxx - n * mean_x * mean_x) / (n - 1.0);
+        double cov = (t.sxy - n * mean_x * mean_y) / (n - 1.0);
+        if (var_x > 0.0) {
+            double beta = cov / var_x;
+            price = mean_y - beta * (mean_x - p.control_mean);
+            var = var_y - beta * cov;
+        }
+    }
+    return {price, std::sqrt(std::max(var, 0.0) / n), s.antithetic ? 2 * samples : samples};
+}
+}
+
+double MonteCarloEngine::price(const quant::instruments::Instrument& inst) const {
+    if (const auto* opt = dynamic_cast<const quant::instruments::EuropeanOption*>(&inst)) return price(*opt);
+    if (const auto* opt = dynamic_cast<const quant::instruments::BarrierOption*>(&inst)) return price(*opt);
+    throw quant::core::PricingError("Instrument is not EuropeanOption or BarrierOption");
+}
+
+double MonteCarloEngine::price(const quant::instruments::EuropeanOption& opt) const { return simulate(opt).price; }
+
+double MonteCarloEngine::price(const quant::instruments::BarrierOption& opt) const { return simulate(opt).price; }
+
+MonteCarloResult MonteCarloEngine::simulate(const quant::instruments::EuropeanOption& opt) const {
+    Product p{opt.option_type(), opt.spot(), opt.strike(), opt.maturity(), opt.rate(), opt.dividend(),
+              opt.volatility(), false, BarrierType::UpAndOut, 0.0, 0.0,
+              opt.spot() * std::exp(-opt.dividend() * opt.maturity()), 1};
+    return run(p, settings_);
+}
+
+MonteCarloResult MonteCarloEngine::simulate(const quant::instruments::BarrierOption& opt) const {
+    double vanilla = black_scholes<BSPrice>(opt.option_type(), opt.spot(), opt.strike(), opt.maturity(), opt.rate(),
+                                            0.0, opt.volatility()).price;
+    Product p{opt.option_type(), opt.spot(), opt.strike(), opt.maturity(), opt.rate(), 0.0, opt.volatility(),
+              true, opt.barrier_type(), opt.barrier(), opt.rebate(), vanilla, settings_.steps};
+    return run(p, settings_);
+}
+
+} // namespace quant::pricing
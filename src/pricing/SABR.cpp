@@ -1,33 +1,136 @@
 #include "quant/pricing/SABR.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Optimize.hpp"
+#include "quant/core/Parallel.hpp"
+#include "quant/core/Simd.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
+#include "quant/pricing/SABRKernel.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
 namespace quant::pricing {
 
+namespace {
+namespace simd = quant::core::simd;
+constexpr std::size_t W = simd::width;
+constexpr double kSmallZ = 1e-4; // series threshold of sabr_vol<double>
+
+using SmileTerms = SABRSmileTerms<double>;
+
+SmileTerms smile_terms(double alpha, double beta, double rho, double nu, double forward, double maturity) {
+    return sabr_smile_terms(alpha, beta, rho, nu, forward, maturity);
+}
+
+void hagan_strip(const SmileTerms& t, const double* strikes, double* vols) {
+    using namespace simd;
+    const Vec zero = broadcast(0.0), one = broadcast(1.0), half = broadcast(0.5);
+    const Vec rho = broadcast(t.rho);
+    Vec K = load(strikes);
+    Mask valid = K > zero;
+    Vec log_k = log(select(valid, K, one));
+    Vec log_f = broadcast(t.log_f);
+    Vec L = log_f - log_k;
+    Vec A = exp(broadcast(t.b) * half * (log_f + log_k));
+    Vec z = broadcast(t.z_scale) * A * L;
+    Vec s = sqrt(fma(z, z - broadcast(2.0) * rho, one));
+    Vec x = log((s + z - rho) / broadcast(1.0 - t.rho));
+    Vec series = fma(broadcast(t.small_2) * z - half * rho, z, one);
+    Vec R = select(abs(z) < broadcast(kSmallZ), series, z / x);
+    Vec L2 = L * L;
+    Vec D = fma(fma(broadcast(t.d4), L2, broadcast(t.d2)), L2, one);
+    Vec inv_a = one / A;
+    Vec C = fma(fma(broadcast(t.c_a), inv_a, broadcast(t.c_rb)), inv_a, broadcast(t.c_n));
+    Vec vol = broadcast(t.alpha) * inv_a / D * R * fma(C, broadcast(t.maturity), one);
+    store(vols, select(valid, vol, zero));
+}
+
+inline double logistic(double u) { return 1.0 / (1.0 + std::exp(-u)); }
+
+template <std::size_t N>
+SABRCalibration fit(const SABRSmile& smile, const SABRCalibrationSettings& settings) {
+    const std::size_t m = smile.strikes.size();
+    std::vector<double> w(m, 1.0);
+    double total_weight = static_cast<double>(m);
+    if (!smile.weights.empty()) {
+        total_weight = 0.0;
+        for (std::size_t i = 0; i < m; ++i) {
+            w[i] = std::sqrt(smile.weights[i]);
+            total_weight += smile.weights[i];
+        }
+    }
+
+    // Start from the ATM level: vol ~ alpha F^(beta - 1).
+    std::size_t atm = 0;
+    for (std::size_t i = 1; i < m; ++i) {
+        if (std::fabs(smile.strikes[i] - smile.forward) < std::fabs(smile.strikes[atm] - smile.forward)) atm = i;
+    }
+    double beta0 = std::clamp(settings.beta, 0.0, 1.0);
+    std::array<double, N> u{};
+    u[0] = std::log(smile.vols[atm] * std::pow(smile.forward, 1.0 - beta0));
+    u[1] = 0.0;
+    u[2] = std::log(0.5);
+    if constexpr (N == 4) {
+        double bc = std::clamp(beta0, 0.01, 0.99);
+        u[3] = std::log(bc / (1.0 - bc));
+    }
+    auto params = [&](const std::array<double, N>& x) {
+        double beta = N == 4 ? logistic(x[N - 1]) : beta0;
+        return smile_terms(std::exp(x[0]), beta, std::tanh(x[1]), std::exp(x[2]), smile.forward, smile.maturity);
+    };
+
+    auto problem = [&](const std::array<double, N>& x, double* r, double* J) {
+        SmileTerms t = params(x);
+        std::array<double, 4> g{};
+        for (std::size_t i = 0; i < m; ++i) {
+            r[i] = w[i] * (sabr_vol(t, smile.strikes[i], J ? &g : nullptr) - smile.vols[i]);
+            if (!J) continue;
+            // Chain rule through alpha = e^u0, rho = tanh u1, nu = e^u2, beta = logistic(u3).
+            double* row = J + i * N;
+            row[0] = w[i] * g[0] * t.alpha;
+            row[1] = w[i] * g[2] * (1.0 - t.rho * t.rho);
+            row[2] = w[i] * g[3] * t.nu;
+            if constexpr (N == 4) row[3] = w[i] * g[1] * t.beta * (1.0 - t.beta);
+        }
+    };
+    quant::core::LevenbergMarquardtSettings lm;
+    lm.max_iterations = settings.max_iterations;
+    lm.tolerance = settings.tolerance;
+    auto res = quant::core::levenberg_marquardt<N>(problem, u, m, lm);
+
+    SmileTerms t = params(u);
+    return {SABRModel(t.alpha, t.beta, t.rho, t.nu), std::sqrt(2.0 * res.cost / total_weight), res.iterations,
+            res.converged};
+}
+}
+
 double SABRModel::implied_vol(double F, double K, double T) const {
+    return sabr_implied_vol(alpha_, beta_, rho_, nu_, F, K, T);
+}
+
+double SABRModel::implied_vol(double F, double K, double T, std::array<double, 4>& gradient) const {
+    gradient = {};
     if (F <= 0.0 || K <= 0.0) return 0.0;
-    if (F == K) {
-        double num = alpha_;
-        double den = std::pow(F, 1.0 - beta_);
-        double term1 = ((1.0 - beta_) * (1.0 - beta_) * alpha_ * alpha_) / (24.0 * std::pow(den, 2.0));
-        double term2 = (rho_ * beta_ * nu_ * alpha_) / (4.0 * den);
-        double term3 = ((2.0 - 3.0 * rho_ * rho_) * nu_ * nu_) / 24.0;
-        return (num / den) * (1.0 + (term1 + term2 + term3) * T);
-    }
-    double logFK = std::log(F / K);
-    double FKbeta = std::pow(F * K, (1.0 - beta_) / 2.0);
-    double z = (nu_ / alpha_) * FKbeta * logFK;
-    double xz = 0.0;
-    if (std::abs(z) < 1e-8) {
-        xz = 1.0;
-    } else {
-        xz = std::log((std::sqrt(1.0 - 2.0 * rho_ * z + z * z) + z - rho_) / (1.0 - rho_));
+    return sabr_vol(smile_terms(alpha_, beta_, rho_, nu_, F, T), K, &gradient);
+}
+
+void SABRModel::implied_vols(double F, double T, std::span<const double> strikes, std::span<double> vols) const {
+    if (strikes.size() != vols.size()) throw quant::core::PricingError("SABR strike and vol sizes differ");
+    if (F <= 0.0) {
+        std::fill(vols.begin(), vols.end(), 0.0);
+        return;
     }
-    double term1 = alpha_ / (FKbeta * (1.0 + std::pow(1.0 - beta_, 2.0) * logFK * logFK / 24.0 + std::pow(1.0 - beta_, 4.0) * std::pow(logFK, 4.0) / 1920.0));
-    double term2 = z / xz;
-    double term3 = 1.0 + ((std::pow(1.0 - beta_, 2.0) * alpha_ * alpha_) / (24.0 * std::pow(FKbeta, 2.0)) + (rho_ * beta_ * nu_ * alpha_) / (4.0 * FKbeta) + ((2.0 - 3.0 * rho_ * rho_) * nu_ * nu_) / 24.0) * T;
-    return term1 * term2 * term3;
+    const SmileTerms t = smile_terms(alpha_, beta_, rho_, nu_, F, T);
+    const std::size_t n = strikes.size();
+    std::size_t i = 0;
+    for (; i + W <= n; i += W) hagan_strip(t, strikes.data() + i, vols.data() + i);
+    if (i == n) return;
+    double k[W], v[W];
+    std::fill(k, k + W, F);
+    std::copy(strikes.begin() + static_cast<std::ptrdiff_t>(i), strikes.end(), k);
+    hagan_strip(t, k, v);
+    std::copy(v, v + (n - i), vols.begin() + static_cast<std::ptrdiff_t>(i));
 }
 
 double SABREuropeanEngine::price(const quant::instruments::Instrument& inst) const {
@@ -39,16 +142,30 @@ double SABREuropeanEngine::price(const quant::instruments::Instrument& inst) con
 double SABREuropeanEngine::price(const quant::instruments::EuropeanOption& opt) const {
     double T = opt.maturity();
     double F = opt.spot();
-    double df = std::exp(-discount_rate_ * T);
     double vol = model_.implied_vol(F, opt.strike(), T);
-    if (vol <= 0.0 || T <= 0.0) return 0.0;
-    double d1 = (std::log(F / opt.strike()) + 0.5 * vol * vol * T) / (vol * std::sqrt(T));
-    double d2 = d1 - vol * std::sqrt(T);
-    auto norm_cdf = [](double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); };
-    if (opt.option_type() == quant::instruments::OptionType::Call) {
-        return df * (F * norm_cdf(d1) - opt.strike() * norm_cdf(d2));
+    // Black-76 on the forward: Black-Scholes with dividend yield equal to the discount rate.
+    return black_scholes<BSPrice>(opt.option_type(), F, opt.strike(), T, discount_rate_, discount_rate_, vol).price;
+}
+
+SABRCalibration calibrate_sabr(const SABRSmile& smile, const SABRCalibrationSettings& settings) {
+    std::size_t params = settings.calibrate_beta ? 4 : 3;
+    if (smile.vols.size() != smile.strikes.size() ||
+        (!smile.weights.empty() && smile.weights.size() != smile.strikes.size())) {
+        throw quant::core::DataError("SABR smile sizes differ");
     }
-    return df * (opt.strike() * norm_cdf(-d2) - F * norm_cdf(-d1));
+    if (smile.strikes.size() < params) throw quant::core::DataError("SABR smile has fewer quotes than parameters");
+    if (!(smile.forward > 0.0) || !(smile.maturity > 0.0)) {
+        throw quant::core::DataError("SABR smile needs a positive forward and maturity");
+    }
+    return settings.calibrate_beta ? fit<4>(smile, settings) : fit<3>(smile, settings);
+}
+
+std::vector<SABRCalibration> calibrate_sabr(std::span<const SABRSmile> smiles, const SABRCalibrationSettings& settings) {
+    std::vector<SABRCalibration> out(smiles.size());
+    quant::core::parallel_for(smiles.size(), settings.threads, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) out[i] = calibrate_sabr(smiles[i], settings);
+    });
+    return out;
 }
 
 } // namespace quant::pricing
@@ -0,0 +1,119 @@
+#include "quant/pricing/SwapBook.hpp"
+#include "quant/core/Exceptions.hpp"
+#include "quant/core/Parallel.hpp"
+#include "quant/core/Simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using quant::instruments::SwapType;
+using quant::instruments::VanillaSwap;
+using quant::market::YieldCurve;
+
+namespace quant::pricing {
+
+void SwapBook::reserve(std::size_t swaps, std::size_t cashflows) {
+    for (auto* v : {&notional_, &fixed_rate_, &spread_, &sign_}) v->reserve(swaps);
+    fixed_begin_.reserve(swaps + 1);
+    float_begin_.reserve(swaps + 1);
+    fixed_accrual_.reserve(cashflows / 4);
+    fixed_point_.reserve(cashflows / 4);
+    float_start_.reserve(cashflows);
+    float_end_.reserve(cashflows);
+}
+
+std::uint32_t SwapBook::grid_point(Curve& curve, double t) {
+    auto [it, inserted] = curve.index.try_emplace(t, static_cast<std::uint32_t>(grid_time_.size()));
+    if (inserted) {
+        grid_time_.push_back(t);
+        curve.points.push_back(it->second);
+    }
+    return it->second;
+}
+
+void SwapBook::push_back(const VanillaSwap& swap) {
+    if (!swap.discount_curve()) throw quant::core::PricingError("Swap has no discount curve");
+    push_back(swap, *swap.discount_curve());
+}
+
+void SwapBook::push_back(const VanillaSwap& swap, const YieldCurve& curve) {
+    auto [it, inserted] = curve_index_.try_emplace(&curve, static_cast<std::uint32_t>(curves_.size()));
+    if (inserted) curves_.push_back({&curve, {}, {}});
+    Curve& c = curves_[it->second];
+
+    const auto& cf = swap.cashflows();
+    for (std::size_t i = 0; i < cf.fixed_time.size(); ++i) {
+        fixed_accrual_.push_back(cf.fixed_accrual[i]);
+        fixed_point_.push_back(grid_point(c, cf.fixed_time[i]));
+    }
+    for (std::size_t i = 1; i < cf.float_time.size(); ++i) {
+        float_start_.push_back(grid_point(c, cf.float_time[i - 1]));
+        float_end_.push_back(grid_point(c, cf.float_time[i]));
+    }
+    notional_.push_back(swap.notional());
+    fixed_rate_.push_back(swap.fixed_rate());
+    spread_.push_back(swap.float_spread());
+    sign_.push_back(swap.type() == SwapType::Payer ? 1.0 : -1.0);
+    fixed_begin_.push_back(static_cast<std::uint32_t>(fixed_accrual_.size()));
+    float_begin_.push_back(static_cast<std::uint32_t>(float_end_.size()));
+}
+
+void SwapBookEngine::price(const SwapBook& book, std::span<double> npv) const { price(book, {npv, {}, {}}); }
+
+void SwapBookEngine::price(const SwapBook& book, const SwapBookOutput& out) const {
+    const std::size_t n = book.size();
+    for (auto s : {out.npv, out.fair_rate, out.annuity}) {
+        if (!s.empty() && s.size() != n) throw quant::core::PricingError("Swap book output size mismatch");
+    }
+
+    // The grid: y = -ln P = z t from hinted zero-rate batches, then P = exp(-y).
+    namespace simd = quant::core::simd;
+    std::vector<double> y(book.grid_size()), df(book.grid_size());
+    for (const auto& c : book.curves_) {
+        quant::core::parallel_for(c.points.size(), threads_, min_block_, [&](std::size_t begin, std::size_t end) {
+            constexpr std::size_t chunk = 256;
+            double t[chunk], z[chunk], e[chunk] = {};
+            for (std::size_t b = begin; b < end; b += chunk) {
+                const std::size_t m = std::min(chunk, end - b);
+                for (std::size_t i = 0; i < m; ++i) t[i] = book.grid_time_[c.points[b + i]];
+                c.curve->zero_rate(std::span<const double>(t, m), std::span<double>(z, m));
+                for (std::size_t i = 0; i < m; ++i) e[i] = -z[i] * t[i];
+                if constexpr (simd::width > 1) {
+                    for (std::size_t i = 0; i < m; i += simd::width) simd::store(e + i, simd::exp(simd::load(e + i)));
+                } else {
+                    for (std::size_t i = 0; i < m; ++i) e[i] = std::exp(e[i]);
+                }
+                for (std::size_t i = 0; i < m; ++i) {
+                    y[c.points[b + i]] = z[i] * t[i];
+                    df[c.points[b + i]] = e[i];
+                }
+            }
+        });
+    }
+
+    quant::core::parallel_for(n, threads_, min_block_ / 16, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t s = begin; s < end; ++s) {
+            double annuity = 0.0, float_leg = 0.0, float_annuity = 0.0;
+            for (std::uint32_t k = book.fixed_begin_[s]; k < book.fixed_begin_[s + 1]; ++k) {
+                annuity += book.fixed_accrual_[k] * df[book.fixed_point_[k]];
+            }
+            for (std::uint32_t k = book.float_begin_[s]; k < book.float_begin_[s + 1]; ++k) {
+                const std::uint32_t a = book.float_start_[k], b = book.float_end_[k];
+                float_leg += (y[b] - y[a]) * df[b];
+                float_annuity += (book.grid_time_[b] - book.grid_time_[a]) * df[b];
+            }
+            const double notional = book.notional_[s], spread = book.spread_[s];
+            if (!out.npv.empty()) {
+                out.npv[s] = book.sign_[s] * notional *
+                             (book.fixed_rate_[s] * annuity - (float_leg + spread * float_annuity));
+            }
+            if (!out.fair_rate.empty()) {
+                out.fair_rate[s] = annuity == 0.0 ? std::numeric_limits<double>::quiet_NaN() : float_leg / annuity - spread;
+            }
+            if (!out.annuity.empty()) out.annuity[s] = annuity;
+        }
+    });
+}
+
+} // namespace quant::pricing
@@ -0,0 +1,88 @@
+#include "quant/risk/Revaluation.hpp"
+#include "quant/core/Parallel.hpp"
+#include "quant/instruments/EuropeanOption.hpp"
+#include "quant/instruments/VanillaSwap.hpp"
+
+#include <chrono>
+
+namespace quant::risk {
+
+std::size_t RevaluationGraph::add(std::shared_ptr<const quant::instruments::Instrument> inst) {
+    std::vector<const void*> deps;
+    if (const auto* swap = dynamic_cast<const quant::instruments::VanillaSwap*>(inst.get())) {
+        deps.push_back(swap->discount_curve());
+    } else if (const auto* opt = dynamic_cast<const quant::instruments::EuropeanOption*>(inst.get())) {
+        deps.push_back(opt->yield_curve());
+        deps.push_back(opt->vol_surface());
+    }
+    return add(std::move(inst), deps);
+}
+
+std::size_t RevaluationGraph::add(std::shared_ptr<const quant::instruments::Instrument> inst,
+                                  const std::vector<const quant::market::YieldCurve*>& curves,
+                                  const std::vector<const quant::market::VolSurface*>& surfaces) {
+    std::vector<const void*> deps(curves.begin(), curves.end());
+    deps.insert(deps.end(), surfaces.begin(), surfaces.end());
+    return add(std::move(inst), deps);
+}
+
+std::size_t RevaluationGraph::add(std::shared_ptr<const quant::instruments::Instrument> inst,
+                                  const std::vector<const void*>& deps) {
+    auto index = static_cast<std::uint32_t>(instruments_.size());
+    instruments_.push_back(std::move(inst));
+    npv_.push_back(0.0);
+    dirty_.push_back(0);
+    for (std::size_t i = 0; i < deps.size(); ++i) {
+        bool repeated = false;
+        for (std::size_t j = 0; j < i; ++j) repeated = repeated || deps[j] == deps[i];
+        if (deps[i] && !repeated) dependents_[deps[i]].push_back(index);
+    }
+    mark(index);
+    return index;
+}
+
+void RevaluationGraph::mark(std::uint32_t index) {
+    if (dirty_[index]) return;
+    dirty_[index] = 1;
+    dirty_list_.push_back(index);
+}
+
+void RevaluationGraph::invalidate(const void* object) {
+    auto it = dependents_.find(object);
+    if (it == dependents_.end()) return;
+    for (std::uint32_t index : it->second) mark(index);
+}
+
+void RevaluationGraph::invalidate_all() {
+    for (std::size_t i = 0; i < instruments_.size(); ++i) mark(static_cast<std::uint32_t>(i));
+}
+
+std::size_t RevaluationGraph::dependents(const void* object) const {
+    auto it = dependents_.find(object);
+    return it == dependents_.end() ? 0 : it->second.size();
+}
+
+RevaluationStats RevaluationGraph::revalue() {
+    auto start = std::chrono::steady_clock::now();
+    quant::core::parallel_for(dirty_list_.size(), threads_, 256, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            std::uint32_t index = dirty_list_[i];
+            npv_[index] = instruments_[index]->npv();
+        }
+    });
+    // Flags are cleared only once every repricing succeeded, so a throwing npv() stays dirty.
+    for (std::uint32_t index : dirty_list_) dirty_[index] = 0;
+    last_.touched = dirty_list_.size();
+    last_.total = instruments_.size();
+    last_.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    dirty_list_.clear();
+    return last_;
+}
+
+double RevaluationGraph::total() const {
+    double sum = 0.0;
+    for (double v : npv_) sum += v;
+    return sum;
+}
+
+} // namespace quant::risk
@@ -8,38 +8,47 @@ namespace quant::risk {
 
 double ScenarioEngine::apply(const std::vector<std::shared_ptr<quant::instruments::Instrument>>& portfolio,
                              const ScenarioShock& shock) const {
+    using quant::market::ScaledVolSurface;
+    using quant::market::ShiftedYieldCurve;
     double base_value = 0.0;
     double shocked_value = 0.0;
 
     const auto* bs = dynamic_cast<const quant::pricing::BlackScholesEuropeanEngine*>(&engine_);
     const auto* swap_engine = dynamic_cast<const quant::pricing::DiscountingSwapEngine*>(&engine_);
+    quant::market::CurveShift shift = shock.curve_shift;
+    shift.parallel += shock.rate_parallel_bp / 10000.0;
+    const double vol_scale = 1.0 + shock.vol_shift;
 
     for (const auto& inst : portfolio) {
         if (bs) {
             auto* opt = dynamic_cast<quant::instruments::EuropeanOption*>(inst.get());
             if (opt) {
-                base_value += bs->price(*opt);
-                quant::instruments::EuropeanOption shocked(opt->option_type(), opt->spot() * (1.0 + shock.spot_shift),
-                                                           opt->strike(), opt->maturity(),
-                                                           opt->rate() + shock.rate_parallel_bp / 10000.0,
-                                                           opt->volatility() * (1.0 + shock.vol_shift), opt->dividend());
-                shocked_value += bs->price(shocked);
+                const double shocked_spot = opt->spot() * (1.0 + shock.spot_shift);
+                auto value = [&](const auto& curve, const auto& surface) {
+                    base_value += bs->price(*opt, opt->spot(), curve, surface);
+                    shocked_value += bs->price(*opt, shocked_spot, ShiftedYieldCurve(curve, shift),
+                                               ScaledVolSurface(surface, vol_scale));
+                };
+                const quant::market::YieldCurve* curve = bs->curve() ? bs->curve() : curve_;
+                const quant::market::FlatYieldCurve flat_curve{opt->rate()};
+                const quant::market::FlatVolSurface flat_surface{opt->volatility()};
+                if (curve && surface_) {
+                    value(*curve, *surface_);
+                } else if (curve) {
+                    value(*curve, flat_surface);
+                } else if (surface_) {
+                    value(flat_curve, *surface_);
+                } else {
+                    value(flat_curve, flat_surface);
+                }
                 continue;
             }
         }
         if (swap_engine) {
             auto* swap = dynamic_cast<quant::instruments::VanillaSwap*>(inst.get());
             if (swap && curve_) {
-                base_value += swap_engine->price(*swap);
-                auto times = curve_->times();
-                auto rates = curve_->zero_rates();
-                for (auto& r : rates) r += shock.rate_parallel_bp / 10000.0;
-                quant::market::YieldCurve shocked_curve(times, rates);
-                quant::instruments::VanillaSwap shocked_swap(swap->type(), swap->notional(), swap->fixed_rate(),
-                                                             swap->fixed_schedule(), swap->float_schedule(),
-                                                             swap->fixed_dcc(), swap->float_dcc(),
-                                                             &shocked_curve, swap->float_spread());
-                shocked_value += swap_engine->price(shocked_swap);
+                base_value += swap_engine->price(*swap, *curve_);
+                shocked_value += swap_engine->price(*swap, ShiftedYieldCurve(*curve_, shift));
                 continue;
             }
         }
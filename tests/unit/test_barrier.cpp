@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "quant/pricing/BarrierOption.hpp"
+#include "quant/pricing/BlackScholes.hpp"
+#include "quant/pricing/MonteCarlo.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::pricing;
+
+namespace {
+// Every barrier type and option type, strikes on both sides of the barrier, with and without rebate.
+std::vector<BarrierOption> barrier_cases() {
+    std::vector<BarrierOption> cases;
+    for (BarrierType type : {BarrierType::UpAndOut, BarrierType::DownAndOut, BarrierType::UpAndIn,
+                             BarrierType::DownAndIn}) {
+        bool up = type == BarrierType::UpAndOut || type == BarrierType::UpAndIn;
+        for (OptionType opt : {OptionType::Call, OptionType::Put}) {
+            for (double strike : {90.0, 110.0}) {
+                for (double rebate : {0.0, 2.0}) {
+                    cases.emplace_back(type, opt, 100.0, strike, 1.0, 0.03, 0.25, up ? 120.0 : 85.0, rebate);
+                }
+            }
+        }
+    }
+    return cases;
+}
+}
+
+TEST(AnalyticBarrier, InOutParity) {
+    BlackScholesEuropeanEngine bs;
+    AnalyticBarrierEngine analytic;
+    for (OptionType opt : {OptionType::Call, OptionType::Put}) {
+        for (double strike : {80.0, 100.0, 125.0}) {
+            double vanilla = bs.price(EuropeanOption(opt, 100.0, strike, 0.75, 0.02, 0.3));
+            for (double barrier : {90.0, 115.0}) {
+                bool up = barrier > 100.0;
+                BarrierOption out(up ? BarrierType::UpAndOut : BarrierType::DownAndOut, opt, 100.0, strike, 0.75, 0.02,
+                                  0.3, barrier);
+                BarrierOption in(up ? BarrierType::UpAndIn : BarrierType::DownAndIn, opt, 100.0, strike, 0.75, 0.02,
+                                 0.3, barrier);
+                EXPECT_NEAR(analytic.price(out) + analytic.price(in), vanilla, 1e-10);
+            }
+        }
+    }
+    // Already through the barrier: knock-outs pay the rebate, knock-ins are vanillas.
+    BarrierOption dead(BarrierType::DownAndOut, OptionType::Call, 100.0, 100.0, 1.0, 0.02, 0.3, 105.0, 1.5);
+    EXPECT_DOUBLE_EQ(analytic.price(dead), 1.5);
+    BarrierOption live(BarrierType::DownAndIn, OptionType::Call, 100.0, 100.0, 1.0, 0.02, 0.3, 105.0, 1.5);
+    EXPECT_NEAR(analytic.price(live), bs.price(EuropeanOption(OptionType::Call, 100.0, 100.0, 1.0, 0.02, 0.3)), 1e-12);
+    EXPECT_DOUBLE_EQ(live.npv(), analytic.price(live));
+}
+
+TEST(AnalyticBarrier, MatchesContinuousMonteCarlo) {
+    MonteCarloSettings s;
+    s.paths = 1 << 14;
+    s.steps = 32;
+    s.generator = PathGenerator::SobolBrownianBridge;
+    MonteCarloEngine mc(s);
+    AnalyticBarrierEngine analytic;
+    for (const auto& opt : barrier_cases()) {
+        auto sim = mc.simulate(opt);
+        EXPECT_NEAR(analytic.price(opt), sim.price, 4.0 * sim.std_error + 2e-3);
+    }
+}
+
+TEST(AnalyticBarrier, AgreesWithLattice) {
+    // The CRR tree carries an O(1 / sqrt(N)) barrier-misalignment error, so only loose agreement is expected.
+    AnalyticBarrierEngine analytic;
+    BarrierOptionEngine lattice(2000);
+    for (const auto& opt : barrier_cases()) {
+        double exact = analytic.price(opt);
+        EXPECT_NEAR(lattice.price(opt), exact, 0.08 * exact + 0.1);
+    }
+}
+
+TEST(AnalyticBarrier, DiscreteMonitoringCorrection) {
+    MonteCarloSettings s;
+    s.paths = 100000;
+    s.steps = 52;
+    s.monitoring = BarrierMonitoring::Discrete;
+    MonteCarloEngine weekly(s);
+    AnalyticBarrierEngine continuous;
+    AnalyticBarrierEngine corrected(52);
+    for (double barrier : {80.0, 120.0}) {
+        bool up = barrier > 100.0;
+        BarrierOption opt(up ? BarrierType::UpAndOut : BarrierType::DownAndOut, up ? OptionType::Call : OptionType::Put,
+                          100.0, 100.0, 1.0, 0.03, 0.25, barrier);
+        auto sim = weekly.simulate(opt);
+        EXPECT_NEAR(corrected.price(opt), sim.price, 4.0 * sim.std_error + 0.01);
+        EXPECT_GT(std::fabs(continuous.price(opt) - sim.price), 10.0 * sim.std_error);
+    }
+}
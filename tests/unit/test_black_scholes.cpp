@@ -1,9 +1,13 @@
 #include <gtest/gtest.h>
 #include "quant/pricing/BlackScholes.hpp"
+#include "quant/pricing/BlackScholesBatch.hpp"
 #include "quant/instruments/EuropeanOption.hpp"
 #include "quant/instruments/BarrierOption.hpp"
+#include "quant/market/VolSurface.hpp"
+#include "quant/market/YieldCurve.hpp"
 #include "quant/pricing/BarrierOption.hpp"
 #include "quant/pricing/SABR.hpp"
+#include "quant/risk/Greeks.hpp"
 
 using namespace quant::instruments;
 using namespace quant::pricing;
@@ -31,3 +35,94 @@ TEST(AdvancedPricers, BarrierAndSABR) {
     double sabr_price = sabr.price(opt);
     EXPECT_GT(sabr_price, 0.0);
 }
+
+TEST(BlackScholesBatch, MatchesScalarEngine) {
+    OptionChain chain;
+    std::vector<EuropeanOption> opts;
+    for (int i = 0; i < 1003; ++i) {
+        OptionType type = (i % 3 == 0) ? OptionType::Put : OptionType::Call;
+        double strike = 60.0 + 0.08 * i;
+        double maturity = 0.05 + 0.003 * (i % 500);
+        double vol = 0.05 + 0.0005 * (i % 700);
+        opts.emplace_back(type, 100.0, strike, maturity, 0.03, vol, 0.01 * (i % 4));
+        chain.push_back(opts.back());
+    }
+    std::size_t n = chain.size();
+    std::vector<double> price(n), delta(n), gamma(n), vega(n), theta(n), rho(n);
+    BlackScholesBatchEngine batch(4, 64);
+    batch.price(chain.view(), BlackScholesBatchOutput{price, delta, gamma, vega, theta, rho});
+
+    BlackScholesEuropeanEngine engine;
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_NEAR(price[i], engine.price(opts[i]), 1e-10);
+        EXPECT_NEAR(delta[i], engine.delta(opts[i]), 1e-12);
+        EXPECT_NEAR(gamma[i], engine.gamma(opts[i]), 1e-12);
+        EXPECT_NEAR(vega[i], engine.vega(opts[i]), 1e-10);
+        EXPECT_NEAR(theta[i], engine.theta(opts[i]), 1e-10);
+        EXPECT_NEAR(rho[i], engine.rho(opts[i]), 1e-10);
+    }
+
+    std::vector<double> price_only(n);
+    BlackScholesBatchEngine(1).price(chain.view(), price_only);
+    EXPECT_EQ(price_only, price);
+}
+
+TEST(BlackScholesBatch, ChainReadsAttachedCurveAndSurface) {
+    quant::market::YieldCurve curve({0.25, 1.0, 3.0}, {0.01, 0.025, 0.04});
+    quant::market::VolSurface surface({80.0, 100.0, 120.0}, {0.5, 2.0}, {{0.3, 0.26}, {0.2, 0.22}, {0.24, 0.25}});
+    std::vector<EuropeanOption> opts;
+    for (int i = 0; i < 12; ++i) {
+        opts.emplace_back(i % 2 ? OptionType::Call : OptionType::Put, 100.0, 85.0 + 3.0 * i, 0.3 + 0.2 * i, 0.07,
+                          0.5, 0.01);
+        if (i % 3 != 1) opts.back().set_yield_curve(&curve);
+        if (i % 3 != 2) opts.back().set_vol_surface(&surface);
+    }
+    OptionChain chain;
+    for (const auto& opt : opts) chain.push_back(opt);
+    std::vector<double> price(chain.size());
+    BlackScholesBatchEngine().price(chain.view(), price);
+    for (std::size_t i = 0; i < opts.size(); ++i) EXPECT_NEAR(price[i], opts[i].npv(), 1e-10) << i;
+}
+
+TEST(BlackScholesBatch, DegenerateInputsAndSizeChecks) {
+    OptionChain chain;
+    chain.push_back(OptionType::Call, 100.0, 100.0, 0.0, 0.01, 0.2);
+    chain.push_back(OptionType::Put, 100.0, 100.0, 1.0, 0.01, 0.0);
+    std::vector<double> price(2, -1.0);
+    BlackScholesBatchEngine batch;
+    batch.price(chain.view(), price);
+    EXPECT_EQ(price[0], 0.0);
+    EXPECT_EQ(price[1], 0.0);
+
+    std::vector<double> wrong(3);
+    EXPECT_THROW(batch.price(chain.view(), wrong), quant::core::PricingError);
+}
+
+TEST(BlackScholesKernel, FusedResultMatchesEntryPoints) {
+    BlackScholesEuropeanEngine engine;
+    for (OptionType type : {OptionType::Call, OptionType::Put}) {
+        EuropeanOption opt(type, 105.0, 100.0, 0.75, 0.03, 0.25, 0.02);
+        BSResult all = engine.price_and_greeks(opt);
+        EXPECT_DOUBLE_EQ(all.price, engine.price(opt));
+        EXPECT_DOUBLE_EQ(all.price, opt.npv());
+        EXPECT_DOUBLE_EQ(all.delta, engine.delta(opt));
+        EXPECT_DOUBLE_EQ(all.gamma, engine.gamma(opt));
+        EXPECT_DOUBLE_EQ(all.vega, engine.vega(opt));
+        EXPECT_DOUBLE_EQ(all.theta, engine.theta(opt));
+        EXPECT_DOUBLE_EQ(all.rho, engine.rho(opt));
+
+        BSResult risk = quant::risk::black_scholes_greeks(opt);
+        EXPECT_DOUBLE_EQ(risk.price, all.price);
+        EXPECT_DOUBLE_EQ(quant::risk::black_scholes_theta(opt), all.theta);
+
+        double h = 1e-4;
+        EuropeanOption up(type, 105.0 + h, 100.0, 0.75, 0.03, 0.25, 0.02);
+        EuropeanOption dn(type, 105.0 - h, 100.0, 0.75, 0.03, 0.25, 0.02);
+        EXPECT_NEAR(all.delta, (up.npv() - dn.npv()) / (2.0 * h), 1e-6);
+    }
+
+    BSResult delta_only = black_scholes<BSDelta>(OptionType::Call, 100.0, 100.0, 1.0, 0.05, 0.0, 0.2);
+    EXPECT_NEAR(delta_only.delta, 0.6368, 1e-3);
+    EXPECT_EQ(delta_only.price, 0.0);
+    EXPECT_EQ(delta_only.gamma, 0.0);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include "quant/market/VolSurface.hpp"
+#include "quant/market/YieldCurve.hpp"
+#include "quant/pricing/BlackScholes.hpp"
+#include "quant/pricing/Book.hpp"
+#include "quant/pricing/DiscountingSwap.hpp"
+
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::pricing;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+TEST(Book, StaticPricerMatchesVirtualEngines) {
+    quant::market::YieldCurve curve({0.5, 1.0, 2.0, 5.0, 10.0}, {0.02, 0.022, 0.025, 0.03, 0.032});
+    Book book;
+    std::vector<Book::value_type> trades;
+    for (int i = 0; i < 3000; ++i) {
+        double k = 70.0 + 0.02 * i;
+        switch (i % 3) {
+        case 0:
+            trades.emplace_back(EuropeanOption(i % 2 ? OptionType::Call : OptionType::Put, 100.0, k, 0.1 + 0.001 * i,
+                                               0.03, 0.25, 0.01));
+            break;
+        case 1:
+            trades.emplace_back(BarrierOption(BarrierType::DownAndOut, OptionType::Call, 100.0, k, 1.0, 0.03, 0.2,
+                                              80.0, 0.5));
+            break;
+        default:
+            if (i % 30 == 2) {
+                Schedule s{Date(2024, 1, 15), Date(2024 + i % 7 + 1, 1, 15), Frequency::SemiAnnual};
+                trades.emplace_back(VanillaSwap(SwapType::Payer, 1e6, 0.025, s, s, DayCountConvention::ACT_365,
+                                                DayCountConvention::ACT_365, &curve));
+            }
+        }
+    }
+    for (const auto& t : trades) book.add(t);
+    ASSERT_EQ(book.size(), trades.size());
+    EXPECT_EQ(book.offset<EuropeanOption>(), 0u);
+    EXPECT_EQ(book.offset<BarrierOption>(), book.group<EuropeanOption>().size());
+    EXPECT_EQ(book.offset<VanillaSwap>(), book.size() - book.group<VanillaSwap>().size());
+
+    std::vector<double> values(book.size());
+    BookPricer(2).price(book, values);
+
+    BlackScholesEuropeanEngine bs;
+    AnalyticBarrierEngine barrier;
+    DiscountingSwapEngine swap;
+    std::size_t next[3] = {book.offset<EuropeanOption>(), book.offset<BarrierOption>(), book.offset<VanillaSwap>()};
+    for (const auto& t : trades) {
+        const PricingEngine& engine = t.index() == 0 ? static_cast<const PricingEngine&>(bs)
+                                      : t.index() == 1 ? static_cast<const PricingEngine&>(barrier)
+                                                       : static_cast<const PricingEngine&>(swap);
+        double expected = std::visit([&](const auto& inst) { return engine.price(inst); }, t);
+        EXPECT_NEAR(values[next[t.index()]++], expected, 1e-9 * (1.0 + std::fabs(expected)));
+    }
+
+    std::vector<double> wrong(book.size() + 1);
+    EXPECT_THROW(BookPricer().price(book, wrong), quant::core::PricingError);
+}
+
+TEST(Book, OptionsOnMarketDataMatchNpv) {
+    quant::market::YieldCurve curve({0.25, 1.0, 3.0}, {0.01, 0.025, 0.04});
+    quant::market::VolSurface surface({80.0, 100.0, 120.0}, {0.5, 2.0}, {{0.3, 0.26}, {0.2, 0.22}, {0.24, 0.25}});
+    Book book;
+    std::vector<EuropeanOption> opts;
+    for (int i = 0; i < 200; ++i) {
+        opts.emplace_back(i % 2 ? OptionType::Call : OptionType::Put, 100.0, 80.0 + 0.2 * i, 0.1 + 0.01 * i, 0.07,
+                          0.5, 0.01);
+        if (i % 4 != 1) opts.back().set_yield_curve(&curve);
+        if (i % 4 != 2) opts.back().set_vol_surface(&surface);
+        book.add(opts.back());
+    }
+    std::vector<double> values(book.size());
+    BookPricer(2).price(book, values);
+    for (std::size_t i = 0; i < opts.size(); ++i) {
+        const Instrument& inst = opts[i];
+        EXPECT_NEAR(values[i], inst.npv(), 1e-10) << i;
+    }
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "quant/market/CurveBootstrapper.hpp"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::market;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+namespace {
+struct Quotes {
+    std::vector<std::pair<double, double>> deposits{{7.0 / 365, 0.0301}, {1.0 / 12, 0.0305}, {0.25, 0.0311}};
+    std::vector<std::array<double, 3>> fras{{0.25, 0.5, 0.0318}, {0.5, 0.75, 0.0322}, {0.75, 1.0, 0.0327}};
+    std::vector<VanillaSwap> swaps;
+
+    Quotes() {
+        int years[] = {2, 3, 5, 7, 10, 15, 20, 30};
+        double rates[] = {0.0331, 0.0334, 0.0340, 0.0347, 0.0355, 0.0361, 0.0360, 0.0352};
+        for (int i = 0; i < 8; ++i) {
+            Schedule fixed{Date(2024, 1, 15), Date(2024 + years[i], 1, 15), Frequency::Annual};
+            Schedule floating{Date(2024, 1, 15), Date(2024 + years[i], 1, 15), Frequency::SemiAnnual};
+            swaps.emplace_back(SwapType::Payer, 1e6, rates[i], fixed, floating, DayCountConvention::ACT_365,
+                               DayCountConvention::ACT_360, nullptr, i == 3 ? 0.001 : 0.0);
+        }
+    }
+
+    std::vector<std::size_t> add_to(CurveBootstrapper& b) const {
+        std::vector<std::size_t> index;
+        for (auto [t, r] : deposits) index.push_back(b.add_deposit(t, r));
+        for (auto [s, e, r] : fras) index.push_back(b.add_fra(s, e, r));
+        for (const auto& s : swaps) index.push_back(b.add_swap(s));
+        return index;
+    }
+};
+
+void expect_reprices(const Quotes& q, const CurveBootstrapper& b, const YieldCurve& curve) {
+    std::size_t i = 0;
+    for (auto [t, r] : q.deposits) EXPECT_NEAR(curve.discount(t), 1.0 / (1.0 + b.quote(i++) * t), 1e-14);
+    for (auto [s, e, r] : q.fras) {
+        EXPECT_NEAR(curve.discount(s) / curve.discount(e), 1.0 + b.quote(i++) * (e - s), 1e-13);
+    }
+    for (const auto& s : q.swaps) {
+        VanillaSwap quoted(s.type(), s.notional(), b.quote(i++), s.fixed_schedule(), s.float_schedule(),
+                           s.fixed_dcc(), s.float_dcc(), &curve, s.float_spread());
+        EXPECT_NEAR(quoted.npv(), 0.0, 1e-7);
+    }
+}
+}
+
+TEST(Bootstrap, RoundTripRepricing) {
+    Quotes q;
+    for (auto mode : {CurveInterpolation::LinearZero, CurveInterpolation::LogLinearDiscount}) {
+        CurveBootstrapper b(mode);
+        q.add_to(b);
+        const YieldCurve& curve = b.curve();
+        EXPECT_EQ(curve.times().size(), b.size());
+        EXPECT_EQ(curve.interpolation(), mode);
+        expect_reprices(q, b, curve);
+    }
+}
+
+TEST(Bootstrap, IncrementalUpdateMatchesFullBootstrap) {
+    Quotes q;
+    CurveBootstrapper incremental;
+    auto index = q.add_to(incremental);
+    incremental.curve();
+    // Ticks on a swap, then on a deposit and an FRA together.
+    incremental.set_quote(index[9], 0.0350);
+    incremental.curve();
+    incremental.set_quote(index[1], 0.0307);
+    incremental.set_quote(index[4], 0.0325);
+    const YieldCurve& curve = incremental.curve();
+    expect_reprices(q, incremental, curve);
+
+    CurveBootstrapper full;
+    q.add_to(full);
+    for (std::size_t i = 0; i < incremental.size(); ++i) full.set_quote(i, incremental.quote(i));
+    const YieldCurve& reference = full.curve();
+    for (std::size_t k = 0; k < curve.zero_rates().size(); ++k) {
+        EXPECT_NEAR(curve.zero_rates()[k], reference.zero_rates()[k], 1e-13) << k;
+    }
+}
+
+TEST(Bootstrap, RejectsInvalidSetups) {
+    EXPECT_THROW(CurveBootstrapper(CurveInterpolation::MonotoneConvex), quant::core::DataError);
+    CurveBootstrapper b;
+    EXPECT_THROW(b.curve(), quant::core::DataError);
+    b.add_deposit(0.25, 0.03);
+    b.add_fra(0.0, 0.25, 0.031);
+    EXPECT_THROW(b.curve(), quant::core::DataError);
+}
@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include "quant/core/Date.hpp"
 
+#include <cstdlib>
+#include <set>
+#include <ctime>
+#include <string>
+
 using namespace quant::core;
 
 TEST(DateTest, YearFraction) {
@@ -17,3 +22,105 @@ TEST(DateTest, CalendarAdjust) {
     EXPECT_NE(adjusted.day(), sat.day());
 }
 
+
+TEST(DateTest, SerialCivilRoundTrip) {
+    static_assert(Date(1970, 1, 1).serial() == 0);
+    static_assert(Date(2000, 3, 1) - Date(2000, 2, 28) == 2);
+    static_assert(Date(2024, 1, 31).add_months(1) == Date(2024, 2, 29));
+    static_assert(Date(2023, 4, 1).weekday() == 6);
+    for (int z = days_from_civil(1899, 12, 25); z < days_from_civil(2101, 1, 7); ++z) {
+        Date d = Date::from_serial(z);
+        ASSERT_EQ(Date(d.year(), d.month(), d.day()), d);
+        ASSERT_EQ(d.add_days(1) - d, 1);
+        ASSERT_EQ(d.add_days(1).weekday(), (d.weekday() + 1) % 7);
+        ASSERT_EQ(d.is_end_of_month(), d.add_days(1).day() == 1);
+        ASSERT_EQ(d.end_of_month().add_days(1).day(), 1u);
+    }
+    EXPECT_EQ(Date(1900, 1, 1).weekday(), 1u);
+    EXPECT_EQ(Date(2024, 3, 31).add_months(-13), Date(2023, 2, 28));
+    EXPECT_EQ(Date(2024, 11, 30).add_months(3), Date(2025, 2, 28));
+    EXPECT_EQ(Date(2024, 2, 29).to_string(), "2024-02-29");
+    EXPECT_THROW(Date(2023, 2, 29), DataError);
+    EXPECT_THROW(Date(2023, 13, 1), DataError);
+}
+
+TEST(DateTest, DayCountsIgnoreTimeZone) {
+    // POSIX rules, so no zoneinfo files are needed: US Eastern and Lord Howe's half-hour DST.
+    const char* saved = std::getenv("TZ");
+    std::string previous = saved ? saved : "";
+    for (const char* tz : {"UTC0", "EST5EDT,M3.2.0,M11.1.0", "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0"}) {
+        setenv("TZ", tz, 1);
+        tzset();
+        // Spans a spring-forward night, where a 23-hour local day used to count as zero days.
+        EXPECT_EQ(day_count(Date(2024, 3, 9), Date(2024, 3, 11), DayCountConvention::ACT_365), 2) << tz;
+        EXPECT_EQ(day_count(Date(2024, 10, 5), Date(2024, 10, 7), DayCountConvention::ACT_360), 2) << tz;
+        EXPECT_EQ(day_count(Date(2024, 1, 15), Date(2034, 1, 15), DayCountConvention::ACT_365), 3653) << tz;
+        EXPECT_EQ(Date(2024, 3, 10).weekday(), 0u) << tz;
+        Calendar cal;
+        EXPECT_EQ(cal.advance(Date(2024, 3, 9), 1), Date(2024, 3, 10)) << tz;
+        EXPECT_EQ(cal.adjust(Date(2024, 3, 9)), Date(2024, 3, 11)) << tz;
+        EXPECT_EQ(std::chrono::system_clock::to_time_t(Date(2024, 3, 10).to_time_point()), 1710028800) << tz;
+    }
+    if (saved) setenv("TZ", previous.c_str(), 1);
+    else unsetenv("TZ");
+    tzset();
+}
+
+TEST(DateTest, BusinessDayCountsMatchDayByDay) {
+    std::set<Date> holidays;
+    for (int y = 2020; y <= 2030; ++y) {
+        holidays.insert(Date(y, 1, 1));
+        holidays.insert(Date(y, 12, 25));
+        holidays.insert(Date(y, 5, 1).add_days(static_cast<int>((8 - Date(y, 5, 1).weekday()) % 7)));
+    }
+    holidays.insert(Date(1960, 1, 4)); // before the range: ignored
+    Calendar cal(holidays, 2020, 2030);
+    auto naive_business = [&](const Date& d) { return !d.is_weekend() && !holidays.count(d); };
+    const Date base(2024, 12, 20);
+    for (int i = -40; i < 40; ++i) {
+        Date d = base.add_days(i);
+        ASSERT_EQ(cal.is_business_day(d), naive_business(d)) << d.to_string();
+        long between = 0;
+        for (Date x = base; x < d; x = x.add_days(1)) between += naive_business(x);
+        for (Date x = d; x < base; x = x.add_days(1)) between -= naive_business(x);
+        EXPECT_EQ(cal.business_days_between(base, d), between) << d.to_string();
+        for (long n : {-7L, -1L, 1L, 3L, 25L}) {
+            Date x = d;
+            for (long k = 0; k < std::abs(n);) {
+                x = x.add_days(n > 0 ? 1 : -1);
+                k += naive_business(x);
+            }
+            EXPECT_EQ(cal.advance_business_days(d, n), x) << d.to_string() << " " << n;
+        }
+        Date following = d, preceding = d;
+        while (!naive_business(following)) following = following.add_days(1);
+        while (!naive_business(preceding)) preceding = preceding.add_days(-1);
+        EXPECT_EQ(cal.adjust(d), following);
+        EXPECT_EQ(cal.advance_business_days(d, 0), following);
+        EXPECT_EQ(cal.adjust(d, BusinessDayConvention::Preceding), preceding);
+        EXPECT_EQ(cal.adjust(d, BusinessDayConvention::ModifiedFollowing),
+                  following.month() == d.month() ? following : preceding);
+        EXPECT_EQ(cal.adjust(d, BusinessDayConvention::Unadjusted), d);
+    }
+    EXPECT_EQ(cal.business_days_between(cal.first(), cal.last().add_days(1)),
+              cal.business_days_between(Date(2020, 1, 1), Date(2031, 1, 1)));
+    EXPECT_THROW(cal.is_business_day(Date(2031, 1, 1)), DataError);
+    EXPECT_THROW(cal.advance_business_days(Date(2030, 12, 30), 5), DataError);
+
+    cal.add_holiday(Date(2024, 12, 23));
+    EXPECT_EQ(cal.advance_business_days(Date(2024, 12, 20), 1), Date(2024, 12, 24));
+}
+
+TEST(DateTest, JointCalendars) {
+    Calendar london({Date(2024, 8, 26), Date(2024, 12, 26)}, 2024, 2025);
+    Calendar new_york({Date(2024, 9, 2), Date(2024, 12, 26)}, 2024, 2025);
+    auto either = Calendar::joint(london, new_york);
+    auto both = Calendar::joint(london, new_york, Calendar::JointRule::BusinessDays);
+    for (Date d : {Date(2024, 8, 26), Date(2024, 9, 2)}) {
+        EXPECT_FALSE(either.is_business_day(d));
+        EXPECT_TRUE(both.is_business_day(d));
+    }
+    EXPECT_FALSE(both.is_business_day(Date(2024, 12, 26)));
+    EXPECT_EQ(either.business_days_between(Date(2024, 8, 1), Date(2024, 10, 1)), 43 - 2);
+    EXPECT_THROW(Calendar::joint(london, Calendar()), DataError);
+}
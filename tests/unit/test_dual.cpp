@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "quant/core/Dual.hpp"
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/YieldCurve.hpp"
+#include "quant/pricing/BlackScholesKernel.hpp"
+#include "quant/pricing/SABR.hpp"
+#include "quant/pricing/SABRKernel.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace quant::pricing;
+using quant::core::Dual;
+using quant::instruments::OptionType;
+
+TEST(Dual, BlackScholesGreeksInOneEvaluation) {
+    using D = Dual<4>;
+    for (OptionType type : {OptionType::Call, OptionType::Put}) {
+        for (double K : {80.0, 100.0, 125.0}) {
+            auto d = black_scholes<BSPrice>(type, D::variable(100.0, 0), D(K), D::variable(1.3, 1), D::variable(0.03, 2),
+                                            D(0.01), D::variable(0.25, 3));
+            auto ref = black_scholes(type, 100.0, K, 1.3, 0.03, 0.01, 0.25);
+            EXPECT_NEAR(d.price.value(), ref.price, 1e-12);
+            EXPECT_NEAR(d.price.derivative(0), ref.delta, 1e-12);
+            EXPECT_NEAR(-d.price.derivative(1), ref.theta, 1e-11);
+            EXPECT_NEAR(d.price.derivative(2), ref.rho, 1e-10);
+            EXPECT_NEAR(d.price.derivative(3), ref.vega, 1e-10);
+        }
+    }
+}
+
+TEST(Dual, SabrKernelMatchesAnalyticGradient) {
+    using D = Dual<4>;
+    SABRModel model(0.035, 0.6, -0.3, 0.45);
+    for (double K : {0.01, 0.025, 0.0299999, 0.03, 0.045, 0.08}) {
+        std::array<double, 4> g{};
+        double vol = model.implied_vol(0.03, K, 2.0, g);
+        D d = sabr_implied_vol(D::variable(0.035, 0), D::variable(0.6, 1), D::variable(-0.3, 2), D::variable(0.45, 3),
+                               D(0.03), D(K), D(2.0));
+        EXPECT_NEAR(d.value(), vol, 1e-15);
+        for (std::size_t k = 0; k < 4; ++k) EXPECT_NEAR(d.derivative(k), g[k], 1e-9 * (1.0 + std::fabs(g[k]))) << K;
+    }
+}
+
+TEST(Dual, FloatInstantiationsTrackDouble) {
+    std::vector<double> times{0.5, 1.0, 2.0, 5.0, 10.0};
+    std::vector<double> rates{0.02, 0.022, 0.025, 0.03, 0.032};
+    quant::market::BasicYieldCurve<float> curve_f(times, std::vector<float>(rates.begin(), rates.end()));
+    quant::market::YieldCurve curve(times, rates);
+    for (double t : {0.1, 0.7, 3.3, 9.0, 12.0}) EXPECT_NEAR(curve_f.discount(t), curve.discount(t), 2e-7);
+
+    using quant::instruments::Schedule;
+    Schedule s{quant::core::Date(2024, 1, 15), quant::core::Date(2031, 1, 15), quant::instruments::Frequency::SemiAnnual};
+    quant::instruments::VanillaSwap swap(quant::instruments::SwapType::Payer, 1e6, 0.027, s, s,
+                                         quant::core::DayCountConvention::ACT_365,
+                                         quant::core::DayCountConvention::ACT_360, &curve);
+    EXPECT_NEAR(swap.npv(curve_f), swap.npv(), 0.5);
+
+    for (double K : {70.0, 100.0, 140.0}) {
+        float p = black_scholes<BSPrice>(OptionType::Call, 100.0f, float(K), 0.75f, 0.03f, 0.01f, 0.22f).price;
+        EXPECT_NEAR(p, black_scholes<BSPrice>(OptionType::Call, 100.0, K, 0.75, 0.03, 0.01, 0.22).price, 2e-4);
+        float v = sabr_implied_vol(2.0f, 0.6f, -0.3f, 0.45f, 100.0f, float(K), 0.75f);
+        EXPECT_NEAR(v, sabr_implied_vol(2.0, 0.6, -0.3, 0.45, 100.0, K, 0.75), 1e-5);
+    }
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include "quant/pricing/BlackScholesKernel.hpp"
+#include "quant/pricing/Heston.hpp"
+#include "quant/pricing/ImpliedVol.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::pricing;
+
+TEST(Heston, StripMatchesSingleOptionIntegral) {
+    HestonEngine engine(HestonModel(0.04, 1.5, 0.04, 0.5, -0.7));
+    const std::vector<double> strikes{50.0, 70.0, 90.0, 100.0, 110.0, 130.0, 160.0, 250.0};
+    std::vector<double> calls(strikes.size()), puts(strikes.size());
+    for (double T : {0.02, 0.25, 1.0, 10.0}) {
+        engine.price_strip(OptionType::Call, 100.0, T, 0.03, 0.01, strikes, calls);
+        engine.price_strip(OptionType::Put, 100.0, T, 0.03, 0.01, strikes, puts);
+        for (std::size_t i = 0; i < strikes.size(); ++i) {
+            EuropeanOption call(OptionType::Call, 100.0, strikes[i], T, 0.03, 0.0, 0.01);
+            EuropeanOption put(OptionType::Put, 100.0, strikes[i], T, 0.03, 0.0, 0.01);
+            EXPECT_NEAR(engine.price(call), calls[i], 1e-7) << "T=" << T << " K=" << strikes[i];
+            EXPECT_NEAR(engine.price(put), puts[i], 1e-7) << "T=" << T << " K=" << strikes[i];
+            double parity = 100.0 * std::exp(-0.01 * T) - strikes[i] * std::exp(-0.03 * T);
+            EXPECT_NEAR(calls[i] - puts[i], parity, 1e-10);
+        }
+    }
+}
+
+TEST(Heston, DeterministicVarianceLimitIsBlackScholes) {
+    // As sigma -> 0 the variance follows kappa (theta - v) deterministically.
+    HestonEngine engine(HestonModel(0.09, 2.0, 0.04, 1e-4, 0.0));
+    const double T = 1.0;
+    const double total = 0.04 * T + (0.09 - 0.04) * (1.0 - std::exp(-2.0 * T)) / 2.0;
+    for (double K : {80.0, 100.0, 120.0}) {
+        EuropeanOption put(OptionType::Put, 100.0, K, T, 0.03, 0.0);
+        double bs = black_scholes<BSPrice>(OptionType::Put, 100.0, K, T, 0.03, 0.0, std::sqrt(total / T)).price;
+        EXPECT_NEAR(engine.price(put), bs, 1e-6);
+    }
+}
+
+TEST(Heston, CalibrationRecoversModelFromSurface) {
+    const HestonModel truth(0.03, 2.0, 0.05, 0.6, -0.65);
+    HestonEngine engine(truth);
+    std::vector<double> strikes, tenors{0.1, 0.25, 0.5, 1.0, 2.0, 3.0};
+    for (double K = 70.0; K <= 130.0; K += 5.0) strikes.push_back(K);
+    std::vector<std::vector<double>> prices(strikes.size(), std::vector<double>(tenors.size()));
+    std::vector<double> strip(strikes.size());
+    for (std::size_t j = 0; j < tenors.size(); ++j) {
+        engine.price_strip(OptionType::Call, 100.0, tenors[j], 0.02, 0.0, strikes, strip);
+        for (std::size_t i = 0; i < strikes.size(); ++i) prices[i][j] = strip[i];
+    }
+    auto surface = implied_vol_surface(strikes, tenors, prices, OptionType::Call, 100.0, 0.02);
+
+    auto fit = calibrate_heston(surface, 100.0, 0.02);
+    EXPECT_TRUE(fit.converged);
+    EXPECT_LT(fit.rmse, 1e-6);
+    EXPECT_NEAR(fit.model.v0(), truth.v0(), 1e-4);
+    EXPECT_NEAR(fit.model.kappa(), truth.kappa(), 2e-2);
+    EXPECT_NEAR(fit.model.theta(), truth.theta(), 1e-4);
+    EXPECT_NEAR(fit.model.sigma(), truth.sigma(), 5e-3);
+    EXPECT_NEAR(fit.model.rho(), truth.rho(), 5e-3);
+
+    EXPECT_THROW(HestonModel(0.04, -1.0, 0.04, 0.5, 0.0), quant::core::DataError);
+}
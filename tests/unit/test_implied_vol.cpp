@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "quant/pricing/BlackScholes.hpp"
+#include "quant/pricing/ImpliedVol.hpp"
+
+#include <cmath>
+
+using namespace quant::instruments;
+using namespace quant::pricing;
+
+TEST(ImpliedVol, RoundTripsScalarEngine) {
+    ImpliedVolSolver solver;
+    BlackScholesEuropeanEngine engine;
+    for (OptionType type : {OptionType::Call, OptionType::Put}) {
+        for (double strike : {50.0, 80.0, 100.0, 120.0, 180.0}) {
+            for (double maturity : {0.05, 1.0, 10.0}) {
+                for (double vol : {0.05, 0.25, 1.0}) {
+                    EuropeanOption opt(type, 100.0, strike, maturity, 0.02, vol, 0.01);
+                    double price = engine.price(opt);
+                    double intrinsic = std::max(type == OptionType::Call ? 100.0 * std::exp(-0.01 * maturity) -
+                                                                               strike * std::exp(-0.02 * maturity)
+                                                                         : strike * std::exp(-0.02 * maturity) -
+                                                                               100.0 * std::exp(-0.01 * maturity),
+                                                0.0);
+                    if (price - intrinsic < 1e-8) continue;
+                    EXPECT_NEAR(solver.solve(opt, price), vol, 1e-8)
+                        << "strike " << strike << " maturity " << maturity << " vol " << vol;
+                }
+            }
+        }
+    }
+}
+
+TEST(ImpliedVol, BatchAndArbitrageBounds) {
+    OptionChain chain;
+    std::vector<double> prices;
+    for (int i = 0; i < 3000; ++i) {
+        double strike = 70.0 + 0.02 * i;
+        double vol = 0.1 + 0.0001 * i;
+        EuropeanOption opt(i % 2 ? OptionType::Put : OptionType::Call, 100.0, strike, 0.5, 0.01, vol);
+        chain.push_back(opt);
+        prices.push_back(opt.npv());
+    }
+    std::vector<double> vols(chain.size());
+    ImpliedVolSolver(1e-12, 16, 4).solve(chain.view(), prices, vols);
+    for (std::size_t i = 0; i < vols.size(); ++i) EXPECT_NEAR(vols[i], chain.view().vol[i], 1e-9);
+
+    ImpliedVolSolver solver;
+    EXPECT_TRUE(std::isnan(solver.solve(OptionType::Call, 101.0, 100.0, 100.0, 1.0, 0.0)));
+    EXPECT_TRUE(std::isnan(solver.solve(OptionType::Call, 5.0, 100.0, 90.0, 1.0, 0.0)));
+}
+
+TEST(ImpliedVol, SurfaceFromQuotedPrices) {
+    std::vector<double> strikes{80.0, 100.0, 120.0};
+    std::vector<double> tenors{0.5, 1.0, 2.0};
+    std::vector<std::vector<double>> prices(strikes.size(), std::vector<double>(tenors.size()));
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+        for (std::size_t j = 0; j < tenors.size(); ++j) {
+            double vol = 0.2 + 0.01 * static_cast<double>(i) + 0.02 * static_cast<double>(j);
+            prices[i][j] = EuropeanOption(OptionType::Call, 100.0, strikes[i], tenors[j], 0.03, vol).npv();
+        }
+    }
+    auto surface = implied_vol_surface(strikes, tenors, prices, OptionType::Call, 100.0, 0.03);
+    EXPECT_NEAR(surface.volatility(100.0, 1.0), 0.23, 1e-9);
+    EXPECT_NEAR(surface.volatility(120.0, 2.0), 0.26, 1e-9);
+
+    prices[1][1] = 0.0;
+    EXPECT_THROW(implied_vol_surface(strikes, tenors, prices, OptionType::Call, 100.0, 0.03), quant::core::DataError);
+}
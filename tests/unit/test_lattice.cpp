@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "quant/core/Exceptions.hpp"
+#include "quant/pricing/BarrierOption.hpp"
+#include "quant/pricing/BlackScholes.hpp"
+#include "quant/pricing/Lattice.hpp"
+
+#include <cmath>
+
+using namespace quant::instruments;
+using namespace quant::pricing;
+
+TEST(Lattice, EuropeanMatchesBlackScholes) {
+    BlackScholesEuropeanEngine bs;
+    for (OptionType type : {OptionType::Call, OptionType::Put}) {
+        EuropeanOption opt(type, 100.0, 105.0, 1.0, 0.05, 0.2, 0.01);
+        double exact = bs.price(opt);
+        LatticeSettings s;
+        EXPECT_NEAR(LatticeEngine(s).price(opt), exact, 1e-4);
+        s.type = LatticeType::Binomial;
+        EXPECT_NEAR(LatticeEngine(s).price(opt), exact, 5e-3);
+        s.richardson = true;
+        EXPECT_NEAR(LatticeEngine(s).price(opt), exact, 2e-4);
+    }
+}
+
+TEST(Lattice, AmericanAndBermudanExercise) {
+    EuropeanOption put(OptionType::Put, 100.0, 100.0, 1.0, 0.05, 0.3);
+    LatticeSettings s;
+    s.steps = 4000;
+    s.exercise = ExerciseStyle::American;
+    s.richardson = true;
+    double reference = LatticeEngine(s).price(put);
+
+    s.steps = 200;
+    EXPECT_NEAR(LatticeEngine(s).price(put), reference, 1e-3);
+    s.type = LatticeType::Binomial;
+    EXPECT_NEAR(LatticeEngine(s).price(put), reference, 2e-3);
+    s.type = LatticeType::Trinomial;
+    s.richardson = false;
+    EXPECT_NEAR(LatticeEngine(s).price(put), reference, 1e-2);
+
+    double european = BlackScholesEuropeanEngine().price(put);
+    s.exercise = ExerciseStyle::Bermudan;
+    s.exercise_dates = 4;
+    double bermudan = LatticeEngine(s).price(put);
+    EXPECT_GT(bermudan, european + 0.1);
+    EXPECT_LT(bermudan, reference - 0.05);
+
+    // Without dividends early exercise of a call is never optimal.
+    EuropeanOption call(OptionType::Call, 100.0, 100.0, 1.0, 0.05, 0.3);
+    s.exercise = ExerciseStyle::American;
+    EXPECT_NEAR(LatticeEngine(s).price(call), BlackScholesEuropeanEngine().price(call), 1e-4);
+}
+
+TEST(Lattice, BarriersMatchClosedForm) {
+    AnalyticBarrierEngine analytic;
+    LatticeEngine trinomial;
+    LatticeSettings bs;
+    bs.type = LatticeType::Binomial;
+    bs.steps = 400;
+    LatticeEngine binomial(bs);
+    for (BarrierType type : {BarrierType::UpAndOut, BarrierType::DownAndOut, BarrierType::UpAndIn,
+                             BarrierType::DownAndIn}) {
+        bool up = type == BarrierType::UpAndOut || type == BarrierType::UpAndIn;
+        for (OptionType opt : {OptionType::Call, OptionType::Put}) {
+            for (double strike : {90.0, 110.0}) {
+                for (double rebate : {0.0, 2.0}) {
+                    BarrierOption b(type, opt, 100.0, strike, 1.0, 0.03, 0.25, up ? 120.0 : 85.0, rebate);
+                    double exact = analytic.price(b);
+                    EXPECT_NEAR(trinomial.price(b), exact, 3e-3);
+                    EXPECT_NEAR(binomial.price(b), exact, 2e-2);
+                }
+            }
+        }
+    }
+
+    // A barrier closer than one node spacing forces a finer grid rather than a misplaced barrier.
+    BarrierOption close(BarrierType::DownAndOut, OptionType::Call, 100.0, 100.0, 0.5, 0.02, 0.3, 99.0);
+    EXPECT_NEAR(trinomial.price(close), analytic.price(close), 2e-3);
+
+    BarrierOption in(BarrierType::UpAndIn, OptionType::Put, 100.0, 100.0, 1.0, 0.03, 0.25, 120.0);
+    LatticeSettings american;
+    american.exercise = ExerciseStyle::American;
+    EXPECT_THROW(LatticeEngine(american).price(in), quant::core::PricingError);
+}
+
+TEST(Lattice, BarrierNextToSpotKeepsStepCountBounded) {
+    // Aligning a layer 1e-4 (or a few ulps) from spot would take millions of steps; the engines
+    // keep the requested steps and interpolate between the layers either side of the barrier.
+    AnalyticBarrierEngine analytic;
+    for (LatticeType type : {LatticeType::Trinomial, LatticeType::Binomial}) {
+        LatticeSettings s;
+        s.type = type;
+        LatticeEngine engine(s);
+        for (double barrier : {100.01, 100.0 * (1.0 + 4e-16), 99.99}) {
+            const bool up = barrier > 100.0;
+            BarrierOption out(up ? BarrierType::UpAndOut : BarrierType::DownAndOut, OptionType::Call, 100.0, 100.0,
+                              1.0, 0.03, 0.2, barrier);
+            BarrierOption in(up ? BarrierType::UpAndIn : BarrierType::DownAndIn, OptionType::Call, 100.0, 100.0, 1.0,
+                             0.03, 0.2, barrier);
+            const double vanilla = engine.price(EuropeanOption(OptionType::Call, 100.0, 100.0, 1.0, 0.03, 0.2));
+            const double knock_out = engine.price(out), knock_in = engine.price(in);
+            EXPECT_GT(knock_out, -1e-12) << barrier;
+            EXPECT_LT(knock_out, 0.1 * vanilla) << barrier;
+            EXPECT_NEAR(knock_in + knock_out, vanilla, 1e-10) << barrier;
+            EXPECT_NEAR(knock_out, analytic.price(out), 0.05 * vanilla) << barrier;
+        }
+    }
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include "quant/market/MarketDataFile.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace quant::market;
+
+namespace {
+const std::vector<double> kTimes{0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 30.0};
+const std::vector<double> kRates{0.031, 0.0318, 0.0325, 0.0331, 0.0342, 0.0351, 0.0358};
+const std::vector<double> kStrikes{60.0, 80.0, 100.0, 120.0, 150.0};
+const std::vector<double> kTenors{0.1, 0.5, 1.0, 3.0};
+
+std::vector<double> smile() {
+    std::vector<double> v;
+    for (double k : kStrikes) {
+        for (double t : kTenors) v.push_back(0.2 + 0.02 * std::exp(-t) + 0.3 * std::pow(std::log(k / 100.0), 2));
+    }
+    return v;
+}
+
+MarketData sample() {
+    MarketData data;
+    data.add_yield_curve("USD.linear", YieldCurve(kTimes, kRates));
+    data.add_yield_curve("USD.loglinear", YieldCurve(kTimes, kRates, CurveInterpolation::LogLinearDiscount));
+    data.add_yield_curve("USD.convex", YieldCurve(kTimes, kRates, CurveInterpolation::MonotoneConvex));
+    data.add_vol_surface("SPX.bilinear", VolSurface(kStrikes, kTenors, smile()));
+    data.add_vol_surface("SPX.variance", VolSurface(kStrikes, kTenors, smile(), VolInterpolation::VarianceLinear));
+    data.add_vol_surface("SPX.bicubic", VolSurface(kStrikes, kTenors, smile(), VolInterpolation::Bicubic));
+    data.add_fx_spot(FXSpot("EURUSD", 1.085));
+    data.add_equity_spot(EquitySpot("SPX", 5120.5));
+    return data;
+}
+
+std::string temp_path(const char* name) {
+    return (std::filesystem::temp_directory_path() / (std::string(name) + "." + std::to_string(::getpid()))).string();
+}
+}
+
+TEST(MarketDataFile, MappedObjectsMatchTheWrittenOnes) {
+    const MarketData data = sample();
+    const std::string path = temp_path("market_round_trip.qmd");
+    MarketDataFile::write(data, path);
+    MarketData mapped = MarketDataFile::map(path);
+    std::filesystem::remove(path); // the mapping outlives the directory entry
+
+    for (const char* name : {"USD.linear", "USD.loglinear", "USD.convex"}) {
+        const YieldCurve* a = data.yield_curve(name);
+        const YieldCurve* b = mapped.yield_curve(name);
+        ASSERT_NE(b, nullptr) << name;
+        EXPECT_EQ(b->interpolation(), a->interpolation());
+        for (double t = -0.5; t < 40.0; t += 0.37) {
+            EXPECT_EQ(b->discount(t), a->discount(t)) << name << " " << t;
+            EXPECT_EQ(b->zero_rate(t), a->zero_rate(t)) << name << " " << t;
+        }
+    }
+    for (const char* name : {"SPX.bilinear", "SPX.variance", "SPX.bicubic"}) {
+        const VolSurface* a = data.vol_surface(name);
+        const VolSurface* b = mapped.vol_surface(name);
+        ASSERT_NE(b, nullptr) << name;
+        for (double t : {0.05, 0.3, 1.0, 2.2, 4.0}) {
+            for (double k = 50.0; k < 170.0; k += 3.7) EXPECT_EQ(b->volatility(k, t), a->volatility(k, t)) << name;
+        }
+    }
+    ASSERT_NE(mapped.fx_spot("EURUSD"), nullptr);
+    EXPECT_EQ(mapped.fx_spot("EURUSD")->value(), 1.085);
+    ASSERT_NE(mapped.equity_spot("SPX"), nullptr);
+    EXPECT_EQ(mapped.equity_spot("SPX")->value(), 5120.5);
+    EXPECT_EQ(mapped.yield_curve("EUR"), nullptr);
+
+    // A copy borrows the same mapping; modifying it copies its rates first.
+    MarketData copy = mapped;
+    mapped = MarketData();
+    YieldCurve curve = *copy.yield_curve("USD.linear");
+    std::vector<double> bumped(kRates);
+    for (double& r : bumped) r += 0.01;
+    curve.set_zero_rates(bumped);
+    EXPECT_NEAR(curve.zero_rate(3.0), copy.yield_curve("USD.linear")->zero_rate(3.0) + 0.01, 1e-15);
+    EXPECT_EQ(copy.yield_curve("USD.linear")->zero_rates()[0], kRates[0]);
+}
+
+TEST(MarketDataFile, CopiedObjectsKeepTheMappingAlive) {
+    const MarketData data = sample();
+    const std::string path = temp_path("market_keep_alive.qmd");
+    MarketDataFile::write(data, path);
+    // The MarketData returned by map() is a temporary, gone before the curve is read.
+    YieldCurve curve = *MarketDataFile::map(path).yield_curve("USD.convex");
+    VolSurface surface = *MarketDataFile::map(path).vol_surface("SPX.bicubic");
+    std::filesystem::remove(path);
+    const YieldCurve moved = std::move(curve);
+    for (double t = 0.1; t < 40.0; t += 0.7) {
+        EXPECT_EQ(moved.discount(t), data.yield_curve("USD.convex")->discount(t)) << t;
+    }
+    for (double k = 50.0; k < 170.0; k += 9.1) {
+        EXPECT_EQ(surface.volatility(k, 1.3), data.vol_surface("SPX.bicubic")->volatility(k, 1.3)) << k;
+    }
+}
+
+TEST(MarketDataFile, RejectsDamagedFiles) {
+    const std::string path = temp_path("market_damaged.qmd");
+    MarketDataFile::write(sample(), path);
+    std::vector<char> bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    auto rewrite = [&](const std::vector<char>& b) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(b.data(), static_cast<std::streamsize>(b.size()));
+    };
+
+    auto flipped = bytes;
+    flipped[bytes.size() / 2] ^= 0x10;
+    rewrite(flipped);
+    EXPECT_THROW(MarketDataFile::map(path), quant::core::DataError);
+
+    rewrite(std::vector<char>(bytes.begin(), bytes.end() - 8));
+    EXPECT_THROW(MarketDataFile::map(path, false), quant::core::DataError);
+
+    auto renamed = bytes;
+    renamed[0] = 'X';
+    rewrite(renamed);
+    EXPECT_THROW(MarketDataFile::map(path), quant::core::DataError);
+
+    rewrite(bytes);
+    EXPECT_NO_THROW(MarketDataFile::map(path));
+    std::filesystem::remove(path);
+    EXPECT_THROW(MarketDataFile::map(path), quant::core::DataError);
+
+    MarketData empty;
+    empty.add_yield_curve("empty", YieldCurve());
+    EXPECT_THROW(MarketDataFile::write(empty, path), quant::core::DataError);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "quant/market/MarketSnapshot.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace quant::market;
+
+namespace {
+YieldCurve flat_curve(double rate) { return YieldCurve({1.0, 5.0, 10.0}, {rate, rate, rate}); }
+VolSurface flat_surface(double vol) { return VolSurface({90.0, 110.0}, {1.0}, std::vector<double>{vol, vol}); }
+}
+
+TEST(MarketSnapshot, HandlesAndVersions) {
+    MarketDataStore store;
+    CurveHandle usd = store.curve_handle("USD.OIS");
+    CurveHandle eur = store.curve_handle("EUR.ESTR");
+    EXPECT_EQ(store.curve_handle("USD.OIS").index, usd.index);
+    EXPECT_NE(usd.index, eur.index);
+    SurfaceHandle spx = store.surface_handle("SPX");
+
+    auto empty = store.snapshot();
+    EXPECT_EQ(empty->version(), 0u);
+    EXPECT_EQ(empty->yield_curve(usd), nullptr);
+
+    store.publish(usd, flat_curve(0.03));
+    auto v1 = store.snapshot();
+    EXPECT_EQ(v1->version(), 1u);
+    EXPECT_DOUBLE_EQ(v1->yield_curve(usd)->zero_rate(2.0), 0.03);
+    EXPECT_EQ(v1->yield_curve(eur), nullptr);
+
+    EXPECT_EQ(store.update().set(eur, flat_curve(0.02)).set(spx, flat_surface(0.2)).commit(), 2u);
+    auto v2 = store.snapshot();
+    // Unchanged objects are shared, and older snapshots keep their view.
+    EXPECT_EQ(v2->yield_curve(usd), v1->yield_curve(usd));
+    EXPECT_DOUBLE_EQ(v2->vol_surface(spx)->volatility(100.0, 1.0), 0.2);
+    EXPECT_EQ(v1->vol_surface(spx), nullptr);
+    EXPECT_THROW(store.publish(CurveHandle{7}, flat_curve(0.01)), quant::core::DataError);
+    EXPECT_EQ(store.version(), 2u);
+
+    MarketReader reader(store);
+    EXPECT_EQ(reader.current().version(), 2u);
+    store.publish(usd, flat_curve(0.035));
+    EXPECT_EQ(reader.pinned().version(), 2u);
+    EXPECT_DOUBLE_EQ(reader.current().yield_curve(usd)->zero_rate(2.0), 0.035);
+}
+
+TEST(MarketSnapshot, ConcurrentReadersSeeConsistentVersions) {
+    MarketDataStore store;
+    CurveHandle curve = store.curve_handle("USD.OIS");
+    SurfaceHandle surface = store.surface_handle("SPX");
+    store.update().set(curve, flat_curve(0.0)).set(surface, flat_surface(0.0)).commit();
+
+    // Each version sets curve and surface to the same level; a reader must never see them mixed.
+    constexpr int updates = 2000;
+    std::atomic<bool> done{false};
+    std::atomic<long> reads{0}, torn{0}, backwards{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&] {
+            MarketReader reader(store);
+            std::uint64_t last = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                const MarketSnapshot& s = reader.current();
+                double level = s.yield_curve(curve)->zero_rate(3.0);
+                if (level != s.vol_surface(surface)->volatility(100.0, 1.0)) ++torn;
+                if (level != static_cast<double>(s.version() - 1) * 1e-4) ++torn;
+                if (s.version() < last) ++backwards;
+                last = s.version();
+                ++reads;
+            }
+        });
+    }
+    for (int i = 1; i <= updates; ++i) {
+        store.update().set(curve, flat_curve(i * 1e-4)).set(surface, flat_surface(i * 1e-4)).commit();
+        if (i % 64 == 0) std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : readers) t.join();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(backwards.load(), 0);
+    EXPECT_GT(reads.load(), 0);
+    EXPECT_EQ(store.snapshot()->version(), static_cast<std::uint64_t>(updates + 1));
+}
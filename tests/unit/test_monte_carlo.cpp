@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "quant/core/BrownianBridge.hpp"
+#include "quant/core/Random.hpp"
+#include "quant/core/Sobol.hpp"
+#include "quant/pricing/BarrierOption.hpp"
+#include "quant/pricing/BlackScholes.hpp"
+#include "quant/pricing/MonteCarlo.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::pricing;
+
+TEST(MonteCarlo, PhiloxKnownAnswers) {
+    auto r = quant::core::Philox4x32::generate({0u, 0u, 0u, 0u}, {0u, 0u});
+    EXPECT_EQ(r[0], 0x6627e8d5u);
+    EXPECT_EQ(r[3], 0x9b00dbd8u);
+    r = quant::core::Philox4x32::generate({0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                                          {0xa4093822u, 0x299f31d0u});
+    EXPECT_EQ(r[0], 0xd16cfe09u);
+    EXPECT_EQ(r[3], 0x24126ea1u);
+}
+
+TEST(MonteCarlo, EuropeanMatchesBlackScholes) {
+    EuropeanOption opt(OptionType::Put, 100.0, 105.0, 1.0, 0.03, 0.25, 0.01);
+    double bs = BlackScholesEuropeanEngine().price(opt);
+
+    MonteCarloSettings plain;
+    plain.paths = 200000;
+    plain.antithetic = false;
+    plain.control_variate = false;
+    auto raw = MonteCarloEngine(plain).simulate(opt);
+    EXPECT_NEAR(raw.price, bs, 4.0 * raw.std_error);
+
+    MonteCarloSettings reduced = plain;
+    reduced.antithetic = true;
+    reduced.control_variate = true;
+    auto cv = MonteCarloEngine(reduced).simulate(opt);
+    EXPECT_NEAR(cv.price, bs, 4.0 * cv.std_error);
+    EXPECT_LT(cv.std_error, 0.5 * raw.std_error);
+    EXPECT_EQ(cv.paths, 200000u);
+}
+
+TEST(MonteCarlo, BitIdenticalAcrossThreadCounts) {
+    BarrierOption opt(BarrierType::DownAndOut, OptionType::Call, 100.0, 100.0, 1.0, 0.02, 0.3, 80.0, 1.5);
+    MonteCarloSettings s;
+    s.paths = 20001;
+    s.steps = 50;
+    s.threads = 1;
+    auto one = MonteCarloEngine(s).simulate(opt);
+    s.threads = 3;
+    auto three = MonteCarloEngine(s).simulate(opt);
+    EXPECT_EQ(one.price, three.price);
+    EXPECT_EQ(one.std_error, three.std_error);
+}
+
+TEST(MonteCarlo, BarrierParityAndMonitoring) {
+    MonteCarloSettings s;
+    s.paths = 50000;
+    s.steps = 52;
+    MonteCarloEngine engine(s);
+    BarrierOption out(BarrierType::UpAndOut, OptionType::Call, 100.0, 100.0, 1.0, 0.01, 0.2, 130.0);
+    BarrierOption in(BarrierType::UpAndIn, OptionType::Call, 100.0, 100.0, 1.0, 0.01, 0.2, 130.0);
+    double vanilla = BlackScholesEuropeanEngine().price(EuropeanOption(OptionType::Call, 100.0, 100.0, 1.0, 0.01, 0.2));
+    // With the vanilla as control variate, knock-in plus knock-out reproduces it exactly.
+    EXPECT_NEAR(engine.price(out) + engine.price(in), vanilla, 1e-9);
+
+    auto continuous = engine.simulate(out);
+    double lattice = BarrierOptionEngine(2000).price(out);
+    EXPECT_NEAR(continuous.price, lattice, 4.0 * continuous.std_error + 0.02);
+
+    s.monitoring = BarrierMonitoring::Discrete;
+    auto discrete = MonteCarloEngine(s).simulate(out);
+    EXPECT_GT(discrete.price, continuous.price);
+}
+
+TEST(QuasiMonteCarlo, SobolSkipAheadAndStratification) {
+    quant::core::SobolSequence plain(3, false);
+    std::vector<double> u(3);
+    auto seq = plain.cursor();
+    seq.next(u.data());
+    seq.next(u.data());
+    EXPECT_NEAR(u[0], 0.5, 1e-9);
+    seq.next(u.data());
+    EXPECT_NEAR(u[0], 0.75, 1e-9);
+    EXPECT_NEAR(u[1], 0.25, 1e-9);
+
+    quant::core::SobolSequence sobol(quant::core::SobolSequence::max_dimension(), true, 7);
+    std::vector<double> a(sobol.dimension()), b(sobol.dimension());
+    auto walk = sobol.cursor();
+    for (int i = 0; i < 1000; ++i) walk.next(a.data());
+    auto jump = sobol.cursor(999);
+    jump.next(b.data());
+    EXPECT_EQ(a, b);
+
+    // Scrambling keeps every 1-D projection of the first 2^k points one per interval of width 2^-k.
+    constexpr std::size_t n = 1024;
+    std::vector<std::vector<int>> hits(sobol.dimension(), std::vector<int>(n, 0));
+    auto c = sobol.cursor();
+    for (std::size_t i = 0; i < n; ++i) {
+        c.next(a.data());
+        for (std::size_t d = 0; d < a.size(); ++d) ++hits[d][static_cast<std::size_t>(a[d] * n)];
+    }
+    for (const auto& h : hits) {
+        for (int count : h) EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(QuasiMonteCarlo, BrownianBridgeIncrementsAreIndependent) {
+    // On a unit-time grid the map from normals to increments must be orthogonal.
+    constexpr std::size_t n = 13;
+    quant::core::BrownianBridge bridge(n);
+    std::vector<std::vector<double>> cols(n, std::vector<double>(n));
+    for (std::size_t i = 0; i < n; ++i) {
+        std::vector<double> e(n, 0.0);
+        e[i] = 1.0;
+        bridge.transform(e.data(), cols[i].data());
+    }
+    for (std::size_t r = 0; r < n; ++r) {
+        for (std::size_t q = 0; q < n; ++q) {
+            double cov = 0.0;
+            for (std::size_t i = 0; i < n; ++i) cov += cols[i][r] * cols[i][q];
+            EXPECT_NEAR(cov, r == q ? 1.0 : 0.0, 1e-12);
+        }
+    }
+    EXPECT_THROW(quant::core::BrownianBridge(std::vector<double>{0.5, 0.5}), quant::core::DataError);
+}
+
+TEST(QuasiMonteCarlo, SobolBridgeBeatsPseudoRandom) {
+    BarrierOption opt(BarrierType::UpAndOut, OptionType::Call, 100.0, 100.0, 1.0, 0.01, 0.2, 130.0);
+    MonteCarloSettings reference;
+    reference.paths = 1 << 18;
+    reference.steps = 64;
+    reference.generator = PathGenerator::SobolBrownianBridge;
+    double target = MonteCarloEngine(reference).price(opt);
+
+    auto rmse = [&](PathGenerator generator) {
+        MonteCarloSettings s = reference;
+        s.paths = 4096;
+        s.generator = generator;
+        double sq = 0.0;
+        for (std::uint64_t seed = 1; seed <= 8; ++seed) {
+            s.seed = seed;
+            double err = MonteCarloEngine(s).price(opt) - target;
+            sq += err * err;
+        }
+        return std::sqrt(sq / 8.0);
+    };
+    double pseudo = rmse(PathGenerator::PseudoRandom);
+    double qmc = rmse(PathGenerator::SobolBrownianBridge);
+    EXPECT_LT(qmc, 0.5 * pseudo);
+
+    MonteCarloSettings s = reference;
+    s.paths = 5000;
+    s.threads = 1;
+    double one = MonteCarloEngine(s).price(opt);
+    s.threads = 3;
+    EXPECT_EQ(one, MonteCarloEngine(s).price(opt));
+
+    EuropeanOption call(OptionType::Call, 100.0, 110.0, 0.5, 0.02, 0.3);
+    s.generator = PathGenerator::Sobol;
+    s.paths = 1 << 14;
+    EXPECT_NEAR(MonteCarloEngine(s).price(call), BlackScholesEuropeanEngine().price(call), 1e-3);
+}
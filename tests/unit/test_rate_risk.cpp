@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "quant/core/Exceptions.hpp"
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/YieldCurve.hpp"
+#include "quant/risk/RateRisk.hpp"
+
+#include <cmath>
+
+using namespace quant::instruments;
+using namespace quant::market;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+namespace {
+const std::vector<double> kTimes{0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0};
+const std::vector<double> kRates{0.031, 0.0318, 0.0325, 0.0331, 0.0336, 0.0342, 0.0347, 0.0351};
+
+VanillaSwap make_swap(int years, SwapType type, double rate, double spread, const YieldCurve* curve) {
+    Schedule fixed{Date(2024, 1, 31), Date(2024 + years, 4, 30), Frequency::SemiAnnual};
+    Schedule floating{Date(2024, 1, 31), Date(2024 + years, 4, 30), Frequency::Quarterly};
+    return VanillaSwap(type, 1e6, rate, fixed, floating, DayCountConvention::ACT_365, DayCountConvention::ACT_360,
+                       curve, spread);
+}
+
+// Central difference of the npv in pillar k, the curve rebuilt each side, per 1bp. The step is
+// small because monotone convex forwards bend sharply between pillars.
+double bumped(const VanillaSwap& swap, CurveInterpolation interpolation, std::size_t k) {
+    const double h = 1e-7;
+    auto npv = [&](double shift) {
+        auto rates = kRates;
+        rates[k] += shift;
+        YieldCurve curve(kTimes, rates, interpolation);
+        return swap.npv(curve);
+    };
+    return (npv(h) - npv(-h)) / (2.0 * h) * 1e-4;
+}
+}
+
+TEST(RateRisk, KeyRatesMatchFiniteDifferences) {
+    for (auto interpolation :
+         {CurveInterpolation::LinearZero, CurveInterpolation::LogLinearDiscount, CurveInterpolation::MonotoneConvex}) {
+        YieldCurve curve(kTimes, kRates, interpolation);
+        // Runs past the last pillar so the flat extrapolation is covered too.
+        for (auto swap : {make_swap(4, SwapType::Payer, 0.034, 0.001, &curve),
+                          make_swap(12, SwapType::Receiver, 0.0335, 0.0, &curve)}) {
+            auto risk = quant::risk::swap_rate_risk(swap);
+            ASSERT_EQ(risk.key_rate.size(), kTimes.size());
+            EXPECT_NEAR(risk.npv, swap.npv(), 1e-8);
+            double sum = 0.0;
+            for (std::size_t k = 0; k < kTimes.size(); ++k) {
+                EXPECT_NEAR(risk.key_rate[k], bumped(swap, interpolation, k), 1e-6) << "pillar " << k;
+                sum += risk.key_rate[k];
+            }
+            EXPECT_NEAR(risk.dv01, sum, 1e-9);
+            EXPECT_GT(std::abs(risk.dv01), 100.0);
+        }
+    }
+}
+
+TEST(RateRisk, BookAggregatesAcrossThreads) {
+    for (auto interpolation : {CurveInterpolation::LinearZero, CurveInterpolation::MonotoneConvex}) {
+        YieldCurve curve(kTimes, kRates, interpolation);
+        std::vector<VanillaSwap> book;
+        for (int i = 0; i < 600; ++i)
+            book.push_back(make_swap(1 + i % 9, i % 2 ? SwapType::Payer : SwapType::Receiver, 0.03 + 1e-5 * i,
+                                     1e-4 * (i % 3), &curve));
+        quant::risk::RateRisk expected;
+        expected.key_rate.assign(kTimes.size(), 0.0);
+        for (const auto& swap : book) {
+            auto risk = quant::risk::swap_rate_risk(swap, curve);
+            expected.npv += risk.npv;
+            expected.dv01 += risk.dv01;
+            for (std::size_t k = 0; k < kTimes.size(); ++k) expected.key_rate[k] += risk.key_rate[k];
+        }
+        for (std::size_t threads : {1u, 4u}) {
+            auto total = quant::risk::book_rate_risk(book, curve, threads);
+            EXPECT_NEAR(total.npv, expected.npv, 1e-6 * (1.0 + std::abs(expected.npv)));
+            EXPECT_NEAR(total.dv01, expected.dv01, 1e-8 * (1.0 + std::abs(expected.dv01)));
+            for (std::size_t k = 0; k < kTimes.size(); ++k)
+                EXPECT_NEAR(total.key_rate[k], expected.key_rate[k], 1e-8 * (1.0 + std::abs(expected.key_rate[k])));
+        }
+    }
+}
+
+TEST(RateRisk, PillarWeightsNeedLocalInterpolation) {
+    YieldCurve convex(kTimes, kRates, CurveInterpolation::MonotoneConvex);
+    EXPECT_THROW(convex.pillar_weights(1.5), quant::core::DataError);
+    YieldCurve linear(kTimes, kRates);
+    auto w = linear.pillar_weights(1.5);
+    EXPECT_EQ(w.lo, 2u);
+    EXPECT_NEAR(w.lo_weight + w.hi_weight, 1.5, 1e-15);
+    auto swap = make_swap(2, SwapType::Payer, 0.03, 0.0, nullptr);
+    EXPECT_THROW(quant::risk::swap_rate_risk(swap), quant::core::PricingError);
+}
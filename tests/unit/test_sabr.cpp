@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "quant/core/Exceptions.hpp"
+#include "quant/pricing/SABR.hpp"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace quant::pricing;
+
+namespace {
+std::vector<double> strike_strip(double forward, std::size_t n) {
+    std::vector<double> k(n);
+    for (std::size_t i = 0; i < n; ++i) k[i] = forward * std::exp(-0.6 + 1.2 * i / (n - 1.0));
+    return k;
+}
+}
+
+TEST(SABR, StripMatchesScalarAndIsContinuousAtTheMoney) {
+    SABRModel model(0.25, 0.6, -0.35, 0.55);
+    const double F = 100.0, T = 2.0;
+    std::vector<double> strikes = strike_strip(F, 37);
+    strikes[18] = F;
+    strikes.push_back(0.0);
+    std::vector<double> vols(strikes.size());
+    model.implied_vols(F, T, strikes, vols);
+    for (std::size_t i = 0; i < strikes.size(); ++i) {
+        EXPECT_NEAR(vols[i], model.implied_vol(F, strikes[i], T), 1e-13) << strikes[i];
+    }
+    EXPECT_EQ(vols.back(), 0.0);
+    // The small-z expansion joins the closed form smoothly around the forward.
+    for (double eps : {1e-9, 1e-7, 1e-5, 1e-3}) {
+        double up = model.implied_vol(F, F * (1.0 + eps), T);
+        double down = model.implied_vol(F, F * (1.0 - eps), T);
+        double atm = model.implied_vol(F, F, T);
+        EXPECT_NEAR(0.5 * (up + down), atm, 2.0 * eps * eps + 1e-14);
+    }
+}
+
+TEST(SABR, GradientMatchesFiniteDifferences) {
+    const std::array<double, 4> p{0.3, 0.5, -0.2, 0.4};
+    const double F = 100.0, T = 1.5;
+    for (double K : {60.0, 95.0, 100.0, 100.0001, 140.0}) {
+        std::array<double, 4> g{};
+        double vol = SABRModel(p[0], p[1], p[2], p[3]).implied_vol(F, K, T, g);
+        EXPECT_DOUBLE_EQ(vol, SABRModel(p[0], p[1], p[2], p[3]).implied_vol(F, K, T));
+        for (std::size_t j = 0; j < 4; ++j) {
+            auto up = p, down = p;
+            const double h = 1e-6;
+            up[j] += h;
+            down[j] -= h;
+            double fd = (SABRModel(up[0], up[1], up[2], up[3]).implied_vol(F, K, T) -
+                         SABRModel(down[0], down[1], down[2], down[3]).implied_vol(F, K, T)) / (2.0 * h);
+            EXPECT_NEAR(g[j], fd, 1e-6 * (1.0 + std::fabs(fd))) << "K=" << K << " param " << j;
+        }
+    }
+}
+
+TEST(SABR, CalibrationRecoversParameters) {
+    std::vector<SABRSmile> smiles;
+    std::vector<SABRModel> truth;
+    for (std::size_t e = 0; e < 12; ++e) {
+        double T = 0.1 + 0.5 * e;
+        double F = 100.0 * std::exp(0.02 * T);
+        truth.emplace_back(0.2 * std::pow(F, 0.5) * (1.0 + 0.02 * e), 0.5, -0.6 + 0.1 * e, 0.8 - 0.05 * e);
+        SABRSmile smile{F, T, strike_strip(F, 30), {}, {}};
+        smile.vols.resize(smile.strikes.size());
+        truth.back().implied_vols(F, T, smile.strikes, smile.vols);
+        smiles.push_back(std::move(smile));
+    }
+    auto fits = calibrate_sabr(smiles);
+    ASSERT_EQ(fits.size(), smiles.size());
+    for (std::size_t e = 0; e < fits.size(); ++e) {
+        EXPECT_TRUE(fits[e].converged) << e;
+        EXPECT_LT(fits[e].rmse, 1e-8) << e;
+        EXPECT_NEAR(fits[e].model.alpha(), truth[e].alpha(), 1e-6 * truth[e].alpha());
+        EXPECT_NEAR(fits[e].model.rho(), truth[e].rho(), 1e-6);
+        EXPECT_NEAR(fits[e].model.nu(), truth[e].nu(), 1e-6);
+    }
+
+    // Free beta on a single well-sampled smile.
+    SABRCalibrationSettings settings;
+    settings.calibrate_beta = true;
+    settings.beta = 0.5;
+    settings.max_iterations = 200;
+    SABRModel model(0.02 * std::pow(100.0, 0.8), 0.2, -0.3, 0.5);
+    SABRSmile smile{100.0, 5.0, strike_strip(100.0, 60), {}, {}};
+    smile.vols.resize(smile.strikes.size());
+    model.implied_vols(smile.forward, smile.maturity, smile.strikes, smile.vols);
+    auto fit = calibrate_sabr(smile, settings);
+    EXPECT_LT(fit.rmse, 1e-7);
+    EXPECT_NEAR(fit.model.beta(), 0.2, 1e-3);
+
+    smile.vols.pop_back();
+    EXPECT_THROW(calibrate_sabr(smile), quant::core::DataError);
+}
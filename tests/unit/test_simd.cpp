@@ -0,0 +1,24 @@
+#include <gtest/gtest.h>
+#include "quant/core/Simd.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace simd = quant::core::simd;
+
+TEST(Simd, ExpMatchesStdUpToOverflow) {
+    // 709.6 needs 2^1024 as the power-of-two scale; 709.79 is past the largest finite double.
+    std::vector<double> x{-708.0, -100.0, -1.0, 0.0, 0.5, 100.0, 709.0, 709.5, 709.6, 709.7, 709.78, 709.79, 800.0};
+    while (x.size() % simd::width != 0) x.push_back(1.0);
+    std::vector<double> y(x.size());
+    for (std::size_t i = 0; i < x.size(); i += simd::width) simd::store(&y[i], simd::exp(simd::load(&x[i])));
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        const double expected = std::exp(x[i]);
+        if (std::isinf(expected)) {
+            EXPECT_TRUE(std::isinf(y[i])) << x[i];
+        } else {
+            ASSERT_TRUE(std::isfinite(y[i])) << x[i];
+            EXPECT_NEAR(y[i] / expected, 1.0, 1e-14) << x[i];
+        }
+    }
+}
@@ -1,11 +1,13 @@
 #include <gtest/gtest.h>
 #include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/Views.hpp"
 #include "quant/market/YieldCurve.hpp"
 #include "quant/pricing/DiscountingSwap.hpp"
 
 using namespace quant::instruments;
 using namespace quant::market;
 using namespace quant::pricing;
+using quant::core::Calendar;
 using quant::core::Date;
 using quant::core::DayCountConvention;
 
@@ -20,3 +22,67 @@ TEST(Swap, ParRate) {
     EXPECT_NEAR(pv, 0.0, 1e-2);
 }
 
+TEST(Swap, CashflowTablesMatchScheduleDates) {
+    std::vector<double> times{0.25, 0.5, 1.0, 2.0, 5.0, 10.0};
+    std::vector<double> rates{0.031, 0.0318, 0.0325, 0.0331, 0.0342, 0.0351};
+    YieldCurve curve(times, rates, CurveInterpolation::MonotoneConvex);
+    Schedule fixed{Date(2024, 1, 31), Date(2031, 3, 31), Frequency::SemiAnnual};
+    Schedule floating{Date(2024, 1, 31), Date(2031, 3, 31), Frequency::Quarterly};
+    VanillaSwap swap(SwapType::Payer, 1e6, 0.034, fixed, floating, DayCountConvention::ACT_365,
+                     DayCountConvention::ACT_360, &curve, 0.001);
+
+    const auto& cf = swap.cashflows();
+    auto fixed_dates = swap.fixed_dates();
+    auto float_dates = swap.float_dates();
+    ASSERT_EQ(cf.fixed_time.size(), fixed_dates.size() - 1);
+    ASSERT_EQ(cf.float_time.size(), float_dates.size());
+    double fixed_leg = 0.0, float_leg = 0.0, annuity = 0.0;
+    for (std::size_t i = 1; i < fixed_dates.size(); ++i) {
+        double tau = quant::core::year_fraction(fixed_dates[i - 1], fixed_dates[i], DayCountConvention::ACT_365);
+        double t = quant::core::year_fraction(fixed.start, fixed_dates[i], DayCountConvention::ACT_365);
+        EXPECT_EQ(cf.fixed_accrual[i - 1], tau);
+        EXPECT_EQ(cf.fixed_time[i - 1], t);
+        annuity += tau * curve.discount(t);
+    }
+    fixed_leg = 1e6 * 0.034 * annuity;
+    for (std::size_t i = 1; i < float_dates.size(); ++i) {
+        double t1 = quant::core::year_fraction(floating.start, float_dates[i - 1], DayCountConvention::ACT_360);
+        double t2 = quant::core::year_fraction(floating.start, float_dates[i], DayCountConvention::ACT_360);
+        EXPECT_EQ(cf.float_time[i], t2);
+        float_leg += 1e6 * (curve.forward_rate(t1, t2) + 0.001) * (t2 - t1) * curve.discount(t2);
+    }
+    EXPECT_NEAR(swap.npv(), fixed_leg - float_leg, 1e-8);
+    EXPECT_NEAR(swap.annuity(), annuity, 1e-14);
+    // The batched YieldCurve path agrees with the point-by-point one curve views take.
+    ShiftedYieldCurve view(curve, CurveShift{});
+    EXPECT_NEAR(swap.npv(view), swap.npv(), 1e-8);
+    EXPECT_NEAR(swap.fair_rate(view), swap.fair_rate(), 1e-15);
+
+    VanillaSwap unspread(SwapType::Payer, 1e6, 0.034, fixed, floating, DayCountConvention::ACT_365,
+                         DayCountConvention::ACT_360, &curve);
+    VanillaSwap par(SwapType::Receiver, 1e6, unspread.fair_rate(), fixed, floating, DayCountConvention::ACT_365,
+                    DayCountConvention::ACT_360, &curve);
+    EXPECT_NEAR(par.npv(), 0.0, 1e-8);
+}
+
+TEST(Swap, ScheduleDatesFollowBusinessDayConvention) {
+    Calendar cal({Date(2024, 12, 25), Date(2024, 12, 26), Date(2025, 3, 31)});
+    Schedule unadjusted{Date(2024, 3, 31), Date(2025, 3, 31), Frequency::Quarterly};
+    Schedule modified = unadjusted;
+    modified.calendar = &cal;
+    Schedule following = modified;
+    following.convention = quant::core::BusinessDayConvention::Following;
+    VanillaSwap swap(SwapType::Payer, 1e6, 0.03, modified, following, DayCountConvention::ACT_365,
+                     DayCountConvention::ACT_360, nullptr);
+
+    // 2024-03-31 and 2024-06-30 are Sundays; dates roll from the start, not from 2024-09-30.
+    std::vector<Date> expected_modified{Date(2024, 3, 29), Date(2024, 6, 28), Date(2024, 9, 30),
+                                        Date(2024, 12, 31), Date(2025, 3, 28)};
+    std::vector<Date> expected_following{Date(2024, 4, 1), Date(2024, 7, 1), Date(2024, 9, 30),
+                                         Date(2024, 12, 31), Date(2025, 4, 1)};
+    EXPECT_EQ(swap.fixed_dates(), expected_modified);
+    EXPECT_EQ(swap.float_dates(), expected_following);
+    const auto& cf = swap.cashflows();
+    EXPECT_EQ(cf.fixed_accrual[0], 91.0 / 365.0);
+    EXPECT_EQ(cf.float_time.back(), 365.0 / 360.0);
+}
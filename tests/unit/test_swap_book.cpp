@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/YieldCurve.hpp"
+#include "quant/pricing/SwapBook.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::market;
+using namespace quant::pricing;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+namespace {
+const std::vector<double> kTimes{0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 30.0};
+const std::vector<double> kRates{0.031, 0.0318, 0.0325, 0.0331, 0.0342, 0.0351, 0.0358};
+
+std::vector<VanillaSwap> make_book(const YieldCurve* usd, const YieldCurve* eur) {
+    std::vector<VanillaSwap> book;
+    for (int i = 0; i < 60; ++i) {
+        Date start(2024, 1 + i % 12, 1 + (i * 7) % 28);
+        Schedule fixed{start, Date(2025 + i % 12, 1 + i % 12, 1 + (i * 7) % 28), i % 3 ? Frequency::Annual : Frequency::SemiAnnual};
+        Schedule floating{fixed.start, fixed.end, Frequency::Quarterly};
+        book.emplace_back(i % 2 ? SwapType::Payer : SwapType::Receiver, 1e6 * (1 + i % 5), 0.03 + 1e-4 * i, fixed,
+                          floating, DayCountConvention::ACT_365, DayCountConvention::ACT_360, i % 4 ? usd : eur,
+                          1e-4 * (i % 7));
+    }
+    return book;
+}
+}
+
+TEST(SwapBook, MatchesSwapBySwapValuation) {
+    YieldCurve usd(kTimes, kRates), eur(kTimes, kRates, CurveInterpolation::MonotoneConvex);
+    auto swaps = make_book(&usd, &eur);
+    SwapBook book;
+    book.reserve(swaps.size());
+    for (const auto& swap : swaps) book.push_back(swap);
+    EXPECT_EQ(book.size(), swaps.size());
+    EXPECT_EQ(book.curves(), 2u);
+    EXPECT_LT(book.grid_size(), book.cashflows());
+
+    for (std::size_t threads : {1u, 4u}) {
+        SwapBookEngine engine(threads, 16);
+        std::vector<double> npv(swaps.size()), fair(swaps.size()), annuity(swaps.size());
+        engine.price(book, {npv, fair, annuity});
+        for (std::size_t i = 0; i < swaps.size(); ++i) {
+            EXPECT_NEAR(npv[i], swaps[i].npv(), 1e-9 * swaps[i].notional()) << i;
+            EXPECT_NEAR(fair[i], swaps[i].fair_rate(), 1e-14) << i;
+            EXPECT_NEAR(annuity[i], swaps[i].annuity(), 1e-14) << i;
+        }
+    }
+
+    // Curves are read when the book is priced.
+    std::vector<double> bumped(kRates);
+    for (double& r : bumped) r += 0.002;
+    usd.set_zero_rates(bumped);
+    std::vector<double> npv(swaps.size());
+    SwapBookEngine().price(book, npv);
+    for (std::size_t i = 0; i < swaps.size(); ++i) EXPECT_NEAR(npv[i], swaps[i].npv(), 1e-9 * swaps[i].notional());
+
+    // Another curve for the same trades.
+    SwapBook on_eur;
+    for (const auto& swap : swaps) on_eur.push_back(swap, eur);
+    SwapBookEngine().price(on_eur, npv);
+    for (std::size_t i = 0; i < swaps.size(); ++i) EXPECT_NEAR(npv[i], swaps[i].npv(eur), 1e-9 * swaps[i].notional());
+}
+
+TEST(SwapBook, RejectsBadInputs) {
+    YieldCurve curve(kTimes, kRates);
+    auto swaps = make_book(&curve, nullptr);
+    SwapBook book;
+    EXPECT_THROW(book.push_back(swaps[0]), quant::core::PricingError);
+    book.push_back(swaps[1]);
+    std::vector<double> wrong(2);
+    EXPECT_THROW(SwapBookEngine().price(book, wrong), quant::core::PricingError);
+
+    Schedule empty{Date(2024, 1, 15), Date(2024, 1, 15), Frequency::Annual};
+    book.push_back(VanillaSwap(SwapType::Payer, 1e6, 0.03, empty, empty, DayCountConvention::ACT_365,
+                               DayCountConvention::ACT_360, &curve));
+    std::vector<double> npv(2), fair(2);
+    SwapBookEngine().price(book, {npv, fair, {}});
+    EXPECT_EQ(npv[1], 0.0);
+    EXPECT_TRUE(std::isnan(fair[1]));
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "quant/instruments/EuropeanOption.hpp"
+#include "quant/instruments/VanillaSwap.hpp"
+#include "quant/market/Views.hpp"
+#include "quant/market/VolSurface.hpp"
+#include "quant/market/YieldCurve.hpp"
+#include "quant/pricing/BlackScholes.hpp"
+#include "quant/pricing/DiscountingSwap.hpp"
+#include "quant/risk/Scenario.hpp"
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace quant::instruments;
+using namespace quant::market;
+using quant::core::Date;
+using quant::core::DayCountConvention;
+
+namespace {
+const std::vector<double> kTimes{0.25, 0.5, 1.0, 2.0, 5.0, 10.0, 30.0};
+const std::vector<double> kRates{0.031, 0.0318, 0.0325, 0.0331, 0.0342, 0.0351, 0.0358};
+
+VanillaSwap make_swap(int years, const YieldCurve* curve) {
+    Schedule fixed{Date(2024, 1, 15), Date(2024 + years, 1, 15), Frequency::Annual};
+    Schedule floating{Date(2024, 1, 15), Date(2024 + years, 1, 15), Frequency::Quarterly};
+    return VanillaSwap(SwapType::Payer, 1e6, 0.034, fixed, floating, DayCountConvention::ACT_365,
+                       DayCountConvention::ACT_360, curve, 0.001);
+}
+}
+
+TEST(Views, ShiftedCurveMatchesRebuiltCurve) {
+    YieldCurve curve(kTimes, kRates);
+    // A parallel shift plus buckets on the pillars is a pillar shift of a linear zero curve.
+    const std::array<double, 3> bucket_times{1.0, 5.0, 10.0};
+    const std::array<double, 3> bucket_shifts{0.002, -0.001, 0.0005};
+    CurveShift shift{0.0005, 0.0, 0.0, bucket_times, bucket_shifts};
+    std::vector<double> rates = kRates;
+    for (std::size_t i = 0; i < rates.size(); ++i) rates[i] += shift(kTimes[i]);
+    YieldCurve rebuilt(kTimes, rates);
+    ShiftedYieldCurve view(curve, shift);
+    for (double t : {0.1, 0.25, 0.7, 1.0, 3.0, 5.0, 7.5, 10.0, 20.0, 40.0}) {
+        EXPECT_NEAR(view.zero_rate(t), rebuilt.zero_rate(t), 1e-15) << t;
+        EXPECT_NEAR(view.discount(t), rebuilt.discount(t), 1e-15) << t;
+        EXPECT_NEAR(view.forward_rate(t, t + 0.25), rebuilt.forward_rate(t, t + 0.25), 1e-13) << t;
+    }
+    EXPECT_NEAR(shift(3.0), 0.0005 + 0.002 - 0.003 * 0.5, 1e-16);
+
+    CurveShift twist{0.0, 0.0001, 10.0};
+    ShiftedYieldCurve twisted(curve, twist);
+    EXPECT_NEAR(twisted.zero_rate(10.0), curve.zero_rate(10.0), 1e-16);
+    EXPECT_NEAR(twisted.zero_rate(2.0), curve.zero_rate(2.0) - 0.0008, 1e-16);
+    auto swap = make_swap(10, &curve);
+    EXPECT_NEAR(swap.npv(view), make_swap(10, &rebuilt).npv(), 1e-7);
+
+    std::array<double, 2> short_times{1.0, 2.0};
+    EXPECT_THROW(ShiftedYieldCurve(curve, CurveShift{0.0, 0.0, 0.0, short_times, bucket_shifts}),
+                 quant::core::DataError);
+}
+
+TEST(Views, ScaledSurfaceAndFlatInputs) {
+    VolSurface surface({80.0, 100.0, 120.0}, {0.5, 1.0}, {{0.25, 0.24}, {0.2, 0.21}, {0.22, 0.23}});
+    ScaledVolSurface scaled(surface, 1.1, 0.01);
+    EXPECT_NEAR(scaled.volatility(90.0, 0.75), surface.volatility(90.0, 0.75) * 1.1 + 0.01, 1e-16);
+
+    FlatYieldCurve flat{0.03};
+    EXPECT_NEAR(flat.discount(2.0), std::exp(-0.06), 1e-16);
+    ShiftedYieldCurve shifted(flat, CurveShift{0.001});
+    EXPECT_NEAR(shifted.zero_rate(5.0), 0.031, 1e-16);
+    EXPECT_NEAR(shifted.forward_rate(1.0, 2.0), 0.031, 1e-15);
+}
+
+TEST(Views, ScenarioEngineMatchesRepricing) {
+    YieldCurve curve(kTimes, kRates);
+    quant::risk::ScenarioShock shock;
+    shock.rate_parallel_bp = 25.0;
+    shock.vol_shift = 0.1;
+    shock.spot_shift = -0.05;
+
+    quant::pricing::DiscountingSwapEngine swap_engine;
+    std::vector<std::shared_ptr<Instrument>> swaps;
+    for (int y : {2, 5, 10}) swaps.push_back(std::make_shared<VanillaSwap>(make_swap(y, &curve)));
+    std::vector<double> rates = kRates;
+    for (double& r : rates) r += 0.0025;
+    YieldCurve bumped(kTimes, rates);
+    double expected = 0.0;
+    for (int y : {2, 5, 10}) expected += make_swap(y, &bumped).npv() - make_swap(y, &curve).npv();
+    quant::risk::ScenarioEngine swap_scenarios(swap_engine, &curve, nullptr);
+    EXPECT_NEAR(swap_scenarios.apply(swaps, shock), expected, 1e-6);
+
+    quant::pricing::BlackScholesEuropeanEngine bs;
+    EuropeanOption opt(OptionType::Call, 100.0, 105.0, 1.0, 0.03, 0.2, 0.01);
+    EuropeanOption shocked(OptionType::Call, 95.0, 105.0, 1.0, 0.0325, 0.22, 0.01);
+    quant::risk::ScenarioEngine option_scenarios(bs, nullptr, nullptr);
+    EXPECT_NEAR(option_scenarios.apply({std::make_shared<EuropeanOption>(opt)}, shock),
+                bs.price(shocked) - bs.price(opt), 1e-12);
+}
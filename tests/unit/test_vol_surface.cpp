@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include "quant/market/VolSurface.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using quant::market::VolInterpolation;
+using quant::market::VolSurface;
+
+namespace {
+const std::vector<double> kStrikes{60.0, 80.0, 90.0, 100.0, 110.0, 125.0, 150.0};
+const std::vector<double> kTenors{0.1, 0.25, 0.5, 1.0, 2.0, 5.0};
+
+std::vector<std::vector<double>> smile() {
+    std::vector<std::vector<double>> v(kStrikes.size(), std::vector<double>(kTenors.size()));
+    for (std::size_t i = 0; i < kStrikes.size(); ++i) {
+        for (std::size_t j = 0; j < kTenors.size(); ++j) {
+            double m = std::log(kStrikes[i] / 100.0);
+            v[i][j] = 0.2 + 0.03 * std::exp(-kTenors[j]) + (0.25 - 0.1 * kTenors[j] / 5.0) * m * m - 0.05 * m;
+        }
+    }
+    return v;
+}
+
+// The nested-vector bilinear lookup the flat grid replaced, clamped to the grid: it extrapolated
+// linearly below the first strike and tenor.
+double reference_bilinear(const std::vector<std::vector<double>>& v, double strike, double tenor) {
+    strike = std::max(strike, kStrikes.front());
+    tenor = std::max(tenor, kTenors.front());
+    auto itK = std::upper_bound(kStrikes.begin(), kStrikes.end(), strike);
+    auto itT = std::upper_bound(kTenors.begin(), kTenors.end(), tenor);
+    std::size_t k1 = itK == kStrikes.begin() ? 0 : static_cast<std::size_t>(itK - kStrikes.begin() - 1);
+    std::size_t k2 = itK == kStrikes.end() ? kStrikes.size() - 1 : k1 + 1;
+    std::size_t t1 = itT == kTenors.begin() ? 0 : static_cast<std::size_t>(itT - kTenors.begin() - 1);
+    std::size_t t2 = itT == kTenors.end() ? kTenors.size() - 1 : t1 + 1;
+    double qk = k1 == k2 ? 0.0 : (strike - kStrikes[k1]) / (kStrikes[k2] - kStrikes[k1]);
+    double qt = t1 == t2 ? 0.0 : (tenor - kTenors[t1]) / (kTenors[t2] - kTenors[t1]);
+    double v1 = v[k1][t1] + qt * (v[k1][t2] - v[k1][t1]);
+    double v2 = v[k2][t1] + qt * (v[k2][t2] - v[k2][t1]);
+    return v1 + qk * (v2 - v1);
+}
+
+std::vector<double> query_strikes() {
+    std::vector<double> k{40.0, 200.0};
+    for (double s : kStrikes) k.insert(k.end(), {s, std::nextafter(s, 0.0), s + 1e-9});
+    for (int i = 0; i < 60; ++i) k.push_back(55.0 + 100.0 * i / 59.0);
+    std::sort(k.begin(), k.end());
+    return k;
+}
+}
+
+TEST(VolSurface, BilinearMatchesNestedGrid) {
+    const auto v = smile();
+    VolSurface surface(kStrikes, kTenors, v);
+    for (double t : {0.0, 0.1, 0.2, 0.25, 0.7, 1.0, 3.0, 5.0, 8.0}) {
+        for (double k : query_strikes()) EXPECT_NEAR(surface.volatility(k, t), reference_bilinear(v, k, t), 1e-15);
+    }
+    EXPECT_DOUBLE_EQ(surface.vol(2, 3), v[2][3]);
+    EXPECT_THROW(VolSurface(kStrikes, kTenors, std::vector<double>(3, 0.2)), quant::core::DataError);
+    EXPECT_THROW(VolSurface({100.0, 90.0}, {1.0}, std::vector<double>{0.2, 0.2}), quant::core::DataError);
+    EXPECT_THROW(VolSurface().volatility(100.0, 1.0), quant::core::DataError);
+}
+
+TEST(VolSurface, BatchAndSliceMatchSingleLookups) {
+    for (auto mode : {VolInterpolation::Bilinear, VolInterpolation::VarianceLinear, VolInterpolation::Bicubic}) {
+        VolSurface surface(kStrikes, kTenors, smile(), mode);
+        std::vector<double> strikes, tenors;
+        for (double t : {0.05, 0.3, 0.3, 1.5, 7.0}) {
+            for (double k : query_strikes()) {
+                strikes.push_back(k);
+                tenors.push_back(t);
+            }
+        }
+        std::vector<double> out(strikes.size());
+        surface.volatility(strikes, tenors, out);
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            EXPECT_NEAR(out[i], surface.volatility(strikes[i], tenors[i]), 1e-15) << static_cast<int>(mode);
+        }
+        auto slice = surface.slice(0.3);
+        auto ks = query_strikes();
+        std::vector<double> sliced(ks.size());
+        slice.volatility(ks, sliced);
+        for (std::size_t i = 0; i < ks.size(); ++i) {
+            EXPECT_NEAR(slice.volatility(ks[i]), surface.volatility(ks[i], 0.3), 1e-15);
+            EXPECT_NEAR(sliced[i], surface.volatility(ks[i], 0.3), 1e-15);
+        }
+    }
+}
+
+TEST(VolSurface, VarianceLinearAndBicubicInterpolation) {
+    const auto v = smile();
+    VolSurface variance(kStrikes, kTenors, v, VolInterpolation::VarianceLinear);
+    VolSurface bicubic(kStrikes, kTenors, v, VolInterpolation::Bicubic);
+    for (std::size_t i = 0; i < kStrikes.size(); ++i) {
+        for (std::size_t j = 0; j < kTenors.size(); ++j) {
+            EXPECT_NEAR(variance.volatility(kStrikes[i], kTenors[j]), v[i][j], 1e-15);
+            EXPECT_NEAR(bicubic.volatility(kStrikes[i], kTenors[j]), v[i][j], 1e-15);
+        }
+        // Total variance is linear between tenor nodes.
+        double t = 0.7, w = (t - 0.5) / 0.5;
+        double expected = (1 - w) * v[i][2] * v[i][2] * 0.5 + w * v[i][3] * v[i][3] * 1.0;
+        EXPECT_NEAR(variance.volatility(kStrikes[i], t) * variance.volatility(kStrikes[i], t) * t, expected, 1e-15);
+    }
+
+    // Bicubic Hermite on three-point slopes reproduces a bilinear function exactly.
+    std::vector<double> grid;
+    auto f = [](double k, double t) { return 0.1 + 0.001 * k + 0.02 * t - 0.0002 * k * t; };
+    for (double k : kStrikes) {
+        for (double t : kTenors) grid.push_back(f(k, t));
+    }
+    VolSurface plane(kStrikes, kTenors, grid, VolInterpolation::Bicubic);
+    for (double t : {0.15, 0.6, 3.3}) {
+        for (double k : {65.0, 95.0, 140.0}) EXPECT_NEAR(plane.volatility(k, t), f(k, t), 1e-14);
+    }
+    // Smooth between nodes: no kink at an interior strike node.
+    double h = 1e-5, k = 100.0, t = 0.7;
+    double left = (bicubic.volatility(k, t) - bicubic.volatility(k - h, t)) / h;
+    double right = (bicubic.volatility(k + h, t) - bicubic.volatility(k, t)) / h;
+    EXPECT_NEAR(left, right, 1e-6);
+}
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include "quant/core/Dual.hpp"
+#include "quant/market/YieldCurve.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using quant::market::BasicYieldCurve;
+using quant::market::CurveInterpolation;
+using quant::market::YieldCurve;
+
+namespace {
+const std::vector<double> kTimes{1.0 / 365, 7.0 / 365, 1.0 / 12, 0.25, 0.5, 1.0, 2.0, 3.0, 5.0, 7.0, 10.0, 20.0, 30.0};
+const std::vector<double> kRates{0.031, 0.0312, 0.0318, 0.0325, 0.0331, 0.0335, 0.0329, 0.0326, 0.0334,
+                                 0.0342, 0.0351, 0.0362, 0.0358};
+
+double reference_zero(double t) {
+    if (t <= kTimes.front()) return kRates.front();
+    if (t >= kTimes.back()) return kRates.back();
+    auto it = std::upper_bound(kTimes.begin(), kTimes.end(), t);
+    std::size_t i = static_cast<std::size_t>(it - kTimes.begin()) - 1;
+    double w = (t - kTimes[i]) / (kTimes[i + 1] - kTimes[i]);
+    return kRates[i] + w * (kRates[i + 1] - kRates[i]);
+}
+
+std::vector<double> query_times() {
+    std::vector<double> t{0.0, -0.5};
+    for (double p : kTimes) t.insert(t.end(), {p, std::nextafter(p, 0.0), p + 1e-9});
+    for (int i = 0; i < 500; ++i) t.push_back(35.0 * std::pow(static_cast<double>(i) / 499.0, 2.0));
+    return t;
+}
+}
+
+TEST(YieldCurve, LinearZeroMatchesBinarySearch) {
+    YieldCurve curve(kTimes, kRates);
+    for (double t : query_times()) {
+        EXPECT_NEAR(curve.zero_rate(t), reference_zero(t), 1e-15) << t;
+        EXPECT_NEAR(curve.discount(t), std::exp(-reference_zero(t) * t), 1e-15) << t;
+    }
+    EXPECT_THROW(YieldCurve({1.0, 1.0}, {0.01, 0.02}), quant::core::DataError);
+}
+
+TEST(YieldCurve, BatchMatchesScalar) {
+    for (auto mode : {CurveInterpolation::LinearZero, CurveInterpolation::LogLinearDiscount,
+                      CurveInterpolation::MonotoneConvex}) {
+        YieldCurve curve(kTimes, kRates, mode);
+        auto t = query_times(); // unsorted head, sorted tail
+        std::vector<double> df(t.size()), z(t.size());
+        curve.discount(t, df);
+        curve.zero_rate(t, z);
+        for (std::size_t i = 0; i < t.size(); ++i) {
+            EXPECT_NEAR(df[i], curve.discount(t[i]), 1e-15) << t[i];
+            EXPECT_EQ(z[i], curve.zero_rate(t[i])) << t[i];
+        }
+    }
+}
+
+TEST(YieldCurve, InterpolationModesRepricePillars) {
+    for (auto mode : {CurveInterpolation::LogLinearDiscount, CurveInterpolation::MonotoneConvex}) {
+        YieldCurve curve(kTimes, kRates, mode);
+        for (std::size_t i = 0; i < kTimes.size(); ++i) {
+            EXPECT_NEAR(curve.zero_rate(kTimes[i]), kRates[i], 1e-14);
+            EXPECT_NEAR(curve.discount(kTimes[i]), std::exp(-kRates[i] * kTimes[i]), 1e-15);
+        }
+        EXPECT_NEAR(curve.zero_rate(40.0), kRates.back(), 1e-15);
+    }
+
+    // Log-linear discounting has flat forwards between pillars; monotone convex is continuous.
+    YieldCurve loglinear(kTimes, kRates, CurveInterpolation::LogLinearDiscount);
+    YieldCurve convex(kTimes, kRates, CurveInterpolation::MonotoneConvex);
+    const double h = 1e-6;
+    for (std::size_t i = 1; i < kTimes.size(); ++i) {
+        double a = kTimes[i - 1], b = kTimes[i];
+        EXPECT_NEAR(loglinear.forward_rate(a + 0.1 * (b - a), a + 0.2 * (b - a)),
+                    loglinear.forward_rate(a + 0.7 * (b - a), a + 0.9 * (b - a)), 1e-12);
+        if (i + 1 < kTimes.size()) {
+            EXPECT_NEAR(convex.forward_rate(b - h, b), convex.forward_rate(b, b + h), 1e-5) << b;
+        }
+    }
+    for (double t = 0.001; t < 30.0; t *= 1.1) EXPECT_NEAR(convex.forward_rate(t, t + 1e-7), 0.033, 0.01) << t;
+}
+
+TEST(YieldCurve, MonotoneConvexPillarDerivatives) {
+    using D = quant::core::Dual<13>;
+    std::vector<D> rates;
+    for (std::size_t k = 0; k < kRates.size(); ++k) rates.push_back(D::variable(kRates[k], k));
+    BasicYieldCurve<D> curve(kTimes, rates, CurveInterpolation::MonotoneConvex);
+    for (double t : {0.002, 0.04, 0.4, 1.5, 4.0, 8.5, 25.0}) {
+        D df = curve.discount(t);
+        for (std::size_t k = 0; k < kRates.size(); ++k) {
+            const double h = 1e-7;
+            auto up = kRates, down = kRates;
+            up[k] += h;
+            down[k] -= h;
+            double fd = (YieldCurve(kTimes, up, CurveInterpolation::MonotoneConvex).discount(t) -
+                         YieldCurve(kTimes, down, CurveInterpolation::MonotoneConvex).discount(t)) /
+                        (2.0 * h);
+            EXPECT_NEAR(df.derivative(k), fd, 1e-6) << t << " pillar " << k;
+        }
+    }
+}